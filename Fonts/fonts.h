@@ -3,17 +3,39 @@
 
 #include <stdint.h>
 
+//Position of a glyph in the packed data, width 0 = not in the font
+typedef struct FontGlyph {
+	const uint16_t offset;
+	const uint8_t width;
+} FontGlyph;
+
+//Glyphs are packed columns (bytesPerColums bytes each, LSB on top)
+//without padding, generated by Tools/fontconv.py
 typedef struct Font {
 	const uint8_t *data;
+	const FontGlyph *glyphs;
 	const uint8_t asciiBegin;
 	const uint8_t asciiEnd;
-	const uint8_t asciiOffset;
-	const uint8_t datasize;
-	const uint8_t length;
 	const uint8_t height;
 	const uint8_t bytesPerColums;
+	const uint8_t spacing;
 } Font;
 
+/*******************************************************************
+ * @name       :FONT_GetGlyph
+ * @date       :2026-10-17
+ * @function   :Find a glyph, the table is indexed by code
+ * @parameters :font, letterNumberAscii
+ * @retvalue   :Glyph, or 0 if the font does not have it
+********************************************************************/
+static inline const FontGlyph *FONT_GetGlyph(const Font *font, uint8_t letterNumberAscii)
+{
+	if (letterNumberAscii < font->asciiBegin || letterNumberAscii > font->asciiEnd) return 0;
+
+	const FontGlyph *glyph = &font->glyphs[letterNumberAscii - font->asciiBegin];
+	return glyph->width ? glyph : 0;
+}
+
 //Font parameters
 extern const Font Arial28x28;
 extern const Font Arial12x12;
@@ -4,12 +4,14 @@
 #define BUTTONS_H
 
 #include <stm32f7xx.h>
+#include "sched.h"
 
 extern volatile uint8_t BUTTON_TopState; 
 extern volatile uint8_t BUTTON_BottomState;
 extern volatile uint8_t BUTTON_RightState;
 extern volatile uint8_t BUTTON_LeftState;
 extern volatile uint8_t BUTTON_Switch;
+extern SCHED_Event BUTTONS_Event;
 
 void BUTTONS_Init(void);
 void EXTI15_10_IRQHandler(void);
@@ -3,14 +3,33 @@
 
 #include <stdint.h>
 #include <stm32f7xx.h>
+#include "sched.h"
 
 #define DS3231_I2C1_AF 0x04
 #define DS3231_I2C_ADRESS 0x68
 
+// Timeout of a transfer in ms (7 bytes take about 1 ms)
+#define DS3231_TIMEOUT 10
+
+// Control register: square wave rate and INT/SQW pin function
+#define DS3231_CONTROL     0x0E
+#define DS3231_CONTROL_RS  0x18 // Rate, 00 = 1 Hz
+#define DS3231_CONTROL_INTCN 0x04 // Pin used for the alarms instead of the square wave
+#define DS3231_CONTROL_RESET 0x1C // Power-on value
+
+// INT/SQW pin (open drain, pulled up here) on EXTI line 1
+#define DS3231_SQW_PORT   GPIOB
+#define DS3231_SQW_CLOCK  RCC_AHB1ENR_GPIOBEN
+#define DS3231_SQW_EXTICR SYSCFG_EXTICR1_EXTI1_PB
+
+extern SCHED_Event DS3231_SecondEvent;
+
 void DS3231_Init(void);
 int DS3231_BCD_DEC(unsigned char x);
 int DS3231_DEC_BCD(unsigned char x);
 void DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeout);
 void DS3231_Write(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeout);
+void DS3231_SquareWaveInit(void);
+void EXTI1_IRQHandler(void);
 
 #endif /* DS3231_H_ */
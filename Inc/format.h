@@ -0,0 +1,15 @@
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include <stdint.h>
+#include <stdarg.h>
+
+// Receives the formatted characters one by one
+typedef void (*FORMAT_Output)(void *context, char c);
+
+// Fixed-point digits for %f (%.1f, %.2f...)
+#define FORMAT_MAX_PRECISION 6
+
+void FORMAT_Print(FORMAT_Output output, void *context, const char *format, va_list args);
+
+#endif /* FORMAT_H */
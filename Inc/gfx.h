@@ -0,0 +1,47 @@
+#ifndef GFX_H_
+#define GFX_H_
+
+#include <stdint.h>
+#include <stdarg.h>
+
+#include "../Fonts/fonts.h"
+
+// Text alignment on x
+#define GFX_ALIGN_LEFT   0
+#define GFX_ALIGN_CENTER 1
+#define GFX_ALIGN_RIGHT  2
+
+// Framebuffer of a display: its size and the kernels written for its
+// memory layout. The rasterizer clips everything before calling them
+typedef struct GFX_Display
+{
+	int16_t width;
+	int16_t height;
+
+	// Set one pixel inside the screen
+	void (*PutPixel)(uint8_t color, int16_t x, int16_t y);
+
+	// Fill a non-empty area inside the screen
+	void (*FillRect)(uint8_t color, int16_t x, int16_t y, int16_t w, int16_t h);
+
+	// Draw font columns first..last-1 (inside the screen) of a glyph at x, y,
+	// rows are not clipped. Optional, pixels are set one by one if 0
+	void (*DrawGlyph)(uint8_t color, int16_t x, int16_t y, const uint8_t *data, uint8_t bytesPerColumn, int16_t first, int16_t last);
+} GFX_Display;
+
+void GFX_SetPixel(const GFX_Display *display, uint8_t color, int16_t x, int16_t y);
+void GFX_FillRect(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, int16_t w, int16_t h);
+void GFX_DrawHLine(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, int16_t w);
+void GFX_DrawVLine(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, int16_t h);
+void GFX_DrawLine(const GFX_Display *display, uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void GFX_DrawRectangle(const GFX_Display *display, uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void GFX_DrawFilledRectangle(const GFX_Display *display, uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void GFX_DrawCircle(const GFX_Display *display, uint8_t color, int16_t x0, int16_t y0, uint8_t radius);
+void GFX_DrawFilledCircle(const GFX_Display *display, uint8_t color, int16_t x0, int16_t y0, int16_t r);
+void GFX_DrawCharacter(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumberAscii);
+void GFX_DrawStr(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, const Font *font, const char *content);
+void GFX_Print(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, uint8_t align, const Font *font, const char *format, va_list args);
+uint16_t GFX_MeasureStr(const Font *font, const char *content);
+uint16_t GFX_Measure(const Font *font, const char *format, va_list args);
+
+#endif /* GFX_H_ */
@@ -0,0 +1,34 @@
+#ifndef POWER_H_
+#define POWER_H_
+
+#include <stdint.h>
+#include <stm32f7xx.h>
+
+// Idle periods from POWER_STOP_MIN ms use Stop mode, shorter ones sleep with WFI
+#define POWER_STOP_MIN 20
+
+// Wake-up timer: LPTIM1 on the LSI (nominal frequency in Hz), divided to about 1 kHz
+#define POWER_LSI_FREQUENCY 32000
+#define POWER_WAKE_PRESCALER 32
+#define POWER_WAKE_PRESC     5 // LPTIM PRESC value of POWER_WAKE_PRESCALER (2^5)
+#define POWER_WAKE_MAX       0xFFFF // Longest Stop period in timer counts
+
+// Time spent in each state since POWER_Init or POWER_ResetResidency
+typedef struct POWER_Residency
+{
+	uint32_t runMs;
+	uint32_t sleepMs;
+	uint32_t stopMs;
+	uint32_t sleeps;  // Number of WFI sleeps
+	uint32_t stops;   // Number of Stop periods
+} POWER_Residency;
+
+void POWER_Init(void);
+void POWER_Idle(uint32_t delay);
+void POWER_Lock(void);
+void POWER_Unlock(void);
+void POWER_GetResidency(POWER_Residency *residency);
+void POWER_ResetResidency(void);
+void LPTIM1_IRQHandler(void);
+
+#endif /* POWER_H_ */
@@ -0,0 +1,53 @@
+#ifndef PROF_H_
+#define PROF_H_
+
+#include <stdint.h>
+#include <stm32f7xx.h>
+
+// 1 to count the cycles of the zones, 0 removes the zones and the profiler code
+#ifndef PROF_ENABLE
+#define PROF_ENABLE 0
+#endif
+
+// Statistics of a zone, in core cycles
+typedef struct PROF_Zone
+{
+	const char *name;
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+	struct PROF_Zone *next; // Next zone of the report, linked on the first run
+	uint8_t listed;
+} PROF_Zone;
+
+// Zone run, ended when it goes out of scope
+typedef struct PROF_Scope
+{
+	PROF_Zone *zone;
+	uint32_t start;
+} PROF_Scope;
+
+#if PROF_ENABLE
+
+// Counts the cycles from here to the end of the enclosing block, returns included.
+// One zone per block
+#define PROF_ZONE(label) \
+	static PROF_Zone PROF_ZoneHere = { .name = (label) }; \
+	PROF_Scope PROF_ScopeHere __attribute__((cleanup(PROF_End))) = { &PROF_ZoneHere, DWT->CYCCNT }
+
+void PROF_Init(void);
+void PROF_End(PROF_Scope *scope);
+void PROF_Report(void);
+void PROF_Reset(void);
+
+#else
+
+#define PROF_ZONE(label)
+#define PROF_Init()
+#define PROF_Report()
+#define PROF_Reset()
+
+#endif
+
+#endif /* PROF_H_ */
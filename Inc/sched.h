@@ -0,0 +1,46 @@
+#ifndef SCHED_H_
+#define SCHED_H_
+
+#include <stdint.h>
+#include <stm32f7xx.h>
+
+// Slots of the timer wheel, one per millisecond (power of 2). Longer
+// delays go around the wheel and are checked once per turn
+#define SCHED_WHEEL_SLOTS 64
+
+// Run to completion, from the main loop
+typedef void (*SCHED_Handler)(void *context);
+
+// Software timer, owned by the scheduler from SCHED_TimerStart until it expires
+// (one-shot) or SCHED_TimerStop
+typedef struct SCHED_Timer
+{
+	SCHED_Handler handler;
+	void *context;
+	uint32_t expiry;             // TIM_Millis time
+	uint32_t period;             // 0 for a one-shot timer
+	struct SCHED_Timer *next;    // Next timer of the slot
+	struct SCHED_Timer **link;   // Pointer to this timer in its slot, 0 when stopped
+} SCHED_Timer;
+
+// Event posted from an interrupt or a task, its handler runs once however often it is posted
+typedef struct SCHED_Event
+{
+	SCHED_Handler handler;
+	void *context;
+	volatile uint8_t pending;
+	struct SCHED_Event *next;
+} SCHED_Event;
+
+void SCHED_Init(void);
+void SCHED_TimerInit(SCHED_Timer *timer, SCHED_Handler handler, void *context);
+void SCHED_TimerStart(SCHED_Timer *timer, uint32_t delay, uint32_t period);
+void SCHED_TimerStop(SCHED_Timer *timer);
+uint8_t SCHED_TimerActive(const SCHED_Timer *timer);
+void SCHED_EventInit(SCHED_Event *event, SCHED_Handler handler, void *context);
+void SCHED_Post(SCHED_Event *event);
+uint8_t SCHED_Poll(void);
+uint32_t SCHED_NextDelay(void);
+void SCHED_Run(void);
+
+#endif /* SCHED_H_ */
@@ -0,0 +1,33 @@
+#ifndef SCREEN_H_
+#define SCREEN_H_
+
+#include <stdint.h>
+
+#include "gfx.h"
+
+// Screens of the clock, drawn on any GFX_Display (the SH1106, or a RAM
+// framebuffer for Tools/golden)
+
+// Columns shown, and pixels left free on each side for the burn-in orbit
+#define SCREEN_WIDTH  128
+#define SCREEN_MARGIN 1
+
+// Values of the clock face
+typedef struct SCREEN_Clock
+{
+	int8_t second;
+	int8_t minute;
+	int8_t hour;
+	int8_t dayWeek;  // 1 = Monday
+	int8_t dayMonth;
+	int8_t month;    // 1 = January
+	int8_t year;     // 0..99
+	int8_t century;
+	float temperature;
+} SCREEN_Clock;
+
+void SCREEN_ClockBackground(const GFX_Display *display);
+void SCREEN_ClockValues(const GFX_Display *display, const SCREEN_Clock *clock);
+void SCREEN_Setting(const GFX_Display *display, const char *title, int value);
+
+#endif /* SCREEN_H_ */
@@ -3,31 +3,43 @@
 
 #include <stdint.h>
 #include <stdarg.h>
-#include <stdio.h>
 #include <stm32f7xx.h>
 
 #include "../Fonts/fonts.h"
+#include "gfx.h"
 
-//Pins activated/desactivated
-#define SH1106_DC_LOW (GPIOA->BSRR=GPIO_BSRR_BR0)
-#define SH1106_DC_HIGH (GPIOA->BSRR=GPIO_BSRR_BS0)
-
-#define SH1106_CS_LOW (GPIOC->BSRR=GPIO_BSRR_BR1)
-#define SH1106_CS_HIGH (GPIOC->BSRR=GPIO_BSRR_BS1)
+// Pins (SCK and MOSI belong to the SPI bus)
+#define SH1106_DC_PORT  GPIOA
+#define SH1106_DC_PIN   0
+#define SH1106_CS_PORT  GPIOC
+#define SH1106_CS_PIN   1
+#define SH1106_RST_PORT GPIOC
+#define SH1106_RST_PIN  0
 
+//Pins activated/desactivated
 #define SH1106_RST_LOW (GPIOC->BSRR=GPIO_BSRR_BR0)
 #define SH1106_RST_HIGH (GPIOC->BSRR=GPIO_BSRR_BS0)
 
-// SPI1_AF in alternate fonction
-#define SH1106_SPI1_AF 0x05 
-
-// Timeout
-#define SH1106_TIMEOUT 1000
+// SPI clock
+#define SH1106_SPI_FREQUENCY 500000
 
 // Screen dimensions
 #define SH1106_WIDTH     (uint16_t) 132
+#define SH1106_VISIBLE_WIDTH (uint16_t) 128 // Columns shown by the panel
 #define SH1106_HEIGHT    (uint8_t) 64
 #define SH1106_DATA_SIZE (uint8_t) 8
+#define SH1106_PAGES     (uint8_t) (SH1106_HEIGHT / SH1106_DATA_SIZE)
+
+// Pixels the picture moves in each direction during the burn-in orbit
+// (1 or 2), leave that margin free on each side of the screen
+#define SH1106_ORBIT_RADIUS 1
+
+// Ticker: most pages of its font and columns rendered ahead of the screen (power of 2)
+#define SH1106_TICKER_PAGES 4
+#define SH1106_TICKER_RING  64
+
+// Unchanged columns allowed inside a flushed window (a new window costs 3 commands)
+#define SH1106_WINDOW_GAP 3
 
 // SH1106 command definitions 
 #define SH1106_CMD_COL_LOW      (uint8_t) 0x00 // Set Lower Column Address
@@ -63,17 +75,48 @@
 #define XLevelH                 (uint8_t) 0x10
 #define YLevel                  (uint8_t) 0xB0
 
+// Text alignment on x for SH1106_FontPrintAligned
+#define SH1106_ALIGN_LEFT   GFX_ALIGN_LEFT
+#define SH1106_ALIGN_CENTER GFX_ALIGN_CENTER
+#define SH1106_ALIGN_RIGHT  GFX_ALIGN_RIGHT
+
+// Called from the DMA interrupt once the last page has been sent
+typedef void (*SH1106_FlushCallback)(void);
+
 void SH1106_Init(void);
 void SH1106_SendCmd(uint8_t cmd);
 void SH1106_SetPixel(uint8_t pixel, int16_t x, int16_t y);
 void SH1106_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumber);
+void SH1106_DrawStr(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format);
 void SH1106_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...);
-void SH1106_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void SH1106_FontPrintAligned(uint8_t color, int16_t x, int16_t y, uint8_t align, const Font *font, const char *format, ...);
+uint16_t SH1106_MeasureStr(const Font *font, const char *content);
+uint16_t SH1106_FontMeasure(const Font *font, const char *format, ...);
+void SH1106_DrawHLine(uint8_t color, int16_t x, int16_t y, int16_t w);
+void SH1106_DrawVLine(uint8_t color, int16_t x, int16_t y, int16_t h);
+void SH1106_DrawLine(uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
 void SH1106_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void SH1106_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void SH1106_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r);
-void SH1106_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius);
+void SH1106_DrawCircle(uint8_t color, int16_t x0, int16_t y0, uint8_t radius);
 void SH1106_ClearBuffer(void);
+void SH1106_BackgroundBegin(void);
+void SH1106_BackgroundEnd(void);
+void SH1106_RestoreBackground(void);
 void SH1106_SendBuffer(void);
+void SH1106_SendBufferDMA(SH1106_FlushCallback callback);
+void SH1106_Present(SH1106_FlushCallback callback);
+uint8_t SH1106_IsBusy(void);
+const uint8_t *SH1106_GetBuffer(void);
+const GFX_Display *SH1106_GetDisplay(void);
+void SH1106_SetOffset(int8_t x, int8_t y);
+void SH1106_OrbitStep(void);
+void SH1106_TickerHorizontal(uint8_t page, const Font *font, const char *text);
+void SH1106_TickerVertical(const Font *font, const char *text);
+void SH1106_TickerStep(void);
+void SH1106_TickerStop(void);
+void SH1106_FadeTo(uint8_t contrast, uint16_t steps);
+void SH1106_FadeOut(uint16_t steps);
+uint8_t SH1106_FadeStep(void);
 
 #endif /* SH1106_H_ */
@@ -0,0 +1,62 @@
+#ifndef SPI_H_
+#define SPI_H_
+
+#include <stdint.h>
+#include <stm32f7xx.h>
+
+// SPI1_AF in alternate fonction (PA5-SCK, PA7-MOSI)
+#define SPI_SPI1_AF 0x05
+
+// Timeout
+#define SPI_TIMEOUT 1000
+
+// DMA stream used for SPI1_TX (DMA2 Stream3, channel 3)
+#define SPI_DMA_STREAM  DMA2_Stream3
+#define SPI_DMA_CHANNEL 3
+#define SPI_DMA_IRQn    DMA2_Stream3_IRQn
+
+// Clock polarity and phase (CPOL << 1 | CPHA)
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+// Level of the DC pin during a transfer
+#define SPI_COMMAND 0
+#define SPI_DATA    1
+
+// Device on the bus. Filled by its driver, then passed to SPI_Register
+typedef struct SPI_Device
+{
+	uint8_t mode;           // SPI_MODE0..3
+	uint32_t frequency;     // Highest SCK frequency in Hz
+	GPIO_TypeDef *csPort;
+	uint8_t csPin;
+	uint8_t csActiveHigh;   // 1 if CS selects the device when high
+	GPIO_TypeDef *dcPort;   // 0 if the device has no DC pin
+	uint8_t dcPin;
+	uint16_t cr1;           // Set by SPI_Register
+} SPI_Device;
+
+// Called from the DMA interrupt at the end of a transfer
+typedef void (*SPI_Callback)(uint8_t error);
+
+// Asynchronous transfer, owned by the bus from SPI_Submit until its callback
+typedef struct SPI_Transfer
+{
+	SPI_Device *device;
+	const uint8_t *data;
+	uint16_t length;
+	uint8_t dc;             // SPI_COMMAND or SPI_DATA
+	SPI_Callback callback;  // Can be 0
+	struct SPI_Transfer *next; // Next transfer of a chain, 0 once queued alone
+} SPI_Transfer;
+
+void SPI_Init(void);
+void SPI_Register(SPI_Device *device);
+void SPI_Write(SPI_Device *device, uint8_t dc, const uint8_t *data, uint16_t length);
+void SPI_Submit(SPI_Transfer *transfer);
+uint8_t SPI_IsBusy(void);
+void DMA2_Stream3_IRQHandler(void);
+
+#endif /* SPI_H_ */
@@ -3,27 +3,33 @@
 
 #include <stdint.h>
 #include <stdarg.h>
-#include <stdio.h>
 #include <stm32f7xx.h>
 
 #include "../Fonts/fonts.h"
+#include "gfx.h"
 
-//Pins activated/desactivated
-#define ST7920_CS_LOW (GPIOC->BSRR=GPIO_BSRR_BR1)
-#define ST7920_CS_HIGH (GPIOC->BSRR=GPIO_BSRR_BS1)
+// Pins (SCK and MOSI belong to the SPI bus)
+#define ST7920_CS_PORT  GPIOC
+#define ST7920_CS_PIN   1
+#define ST7920_RST_PORT GPIOC
+#define ST7920_RST_PIN  0
 
+//Pins activated/desactivated
 #define ST7920_RST_LOW (GPIOC->BSRR=GPIO_BSRR_BR0)
 #define ST7920_RST_HIGH (GPIOC->BSRR=GPIO_BSRR_BS0)
 
-// SPI1_AF in alternate fonction
-#define ST7920_SPI1_AF 0x05 
+// SPI clock
+#define ST7920_SPI_FREQUENCY 500000
 
 // Screen dimensions
 #define ST7920_WIDTH     (uint8_t) 128
 #define ST7920_HEIGHT    (uint8_t) 64
 #define ST7920_DATA_SIZE (uint8_t) 8
+#define ST7920_WORDS     (uint8_t) (ST7920_WIDTH / 16) // GDRAM words per row
 
-static uint8_t Graphic_Check = 0;
+// Text layer (CGROM half-width characters, 8x16 pixels)
+#define ST7920_TEXT_COLUMNS (uint8_t) 16
+#define ST7920_TEXT_ROWS    (uint8_t) 4
 
 // ST7920 command definitions 
 #define ST7920_CMD              (uint8_t) 0xF8 // Command mode
@@ -68,20 +74,37 @@ static uint8_t Graphic_Check = 0;
 #define ST7920_CMD_REVERSE_LINE2 (uint8_t) 0x26 // Reverse display of the third line
 #define ST7920_CMD_REVERSE_LINE3 (uint8_t) 0x27 // Reverse display of the fourth line
 
-// Buffer for display data
-static uint8_t ST7920_Buffer[(ST7920_WIDTH * ST7920_HEIGHT) / ST7920_DATA_SIZE];
+// Text alignment on x for ST7920_FontPrintAligned
+#define ST7920_ALIGN_LEFT   GFX_ALIGN_LEFT
+#define ST7920_ALIGN_CENTER GFX_ALIGN_CENTER
+#define ST7920_ALIGN_RIGHT  GFX_ALIGN_RIGHT
+
+// Called from the DMA interrupt once the stream has been sent
+typedef void (*ST7920_FlushCallback)(void);
 
 void ST7920_Init(void);
 void ST7920_GraphicMode(int enable);
+void ST7920_SendString(int row, int col, char* string); // col in 16-pixel words (two characters)
+void ST7920_TextPrint(uint8_t row, uint8_t column, const char *format, ...);
+void ST7920_TextClear(void);
 void ST7920_SetPixel(uint8_t pixel, int16_t x, int16_t y);
 void ST7920_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumber);
+void ST7920_DrawStr(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format);
 void ST7920_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...);
-void ST7920_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void ST7920_FontPrintAligned(uint8_t color, int16_t x, int16_t y, uint8_t align, const Font *font, const char *format, ...);
+uint16_t ST7920_MeasureStr(const Font *font, const char *content);
+uint16_t ST7920_FontMeasure(const Font *font, const char *format, ...);
+void ST7920_DrawHLine(uint8_t color, int16_t x, int16_t y, int16_t w);
+void ST7920_DrawVLine(uint8_t color, int16_t x, int16_t y, int16_t h);
+void ST7920_DrawLine(uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
 void ST7920_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void ST7920_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void ST7920_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r);
-void ST7920_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius);
+void ST7920_DrawCircle(uint8_t color, int16_t x0, int16_t y0, uint8_t radius);
 void ST7920_ClearBuffer(void);
 void ST7920_SendBuffer(void);
+void ST7920_SendBufferDMA(ST7920_FlushCallback callback);
+uint8_t ST7920_IsBusy(void);
+const uint8_t *ST7920_GetBuffer(void);
 
 #endif /* ST7920_H_ */
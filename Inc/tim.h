@@ -3,6 +3,19 @@
 
 #include <stm32f7xx.h>
 
+// SysTick interrupt above the peripherals, the time base is read in their interrupts
+#define TIM_SYSTICK_PRIORITY 0
+
+void TIM_Init(void);
+void SysTick_Handler(void);
+uint32_t TIM_Millis(void);
+uint32_t TIM_Micros(void);
+uint32_t TIM_Elapsed(uint32_t since);
+uint32_t TIM_ElapsedMicros(uint32_t since);
+uint32_t TIM_Deadline(uint32_t ms);
+uint8_t TIM_Expired(uint32_t deadline);
+uint8_t TIM_Every(uint32_t *next, uint32_t period);
+void TIM_Advance(uint32_t ms);
 void TIM_WaitMicros(unsigned int us);
 void TIM_Wait(unsigned int ms);
 
@@ -1,13 +1,23 @@
 #ifndef USART_H
 #define USART_H
 
-#include <stdio.h>
 #include <stdarg.h>
 #include <stm32f767xx.h>
+#include "sched.h"
 
 #define USART3_AF7 0x07
 
+// Framebuffer capture: "FB", layout, width, height, length (16-bit, LSB first), data, checksum
+#define USART_FRAME_PAGES 0 // Bytes are 8-pixel columns of a page, LSB on top (SH1106)
+#define USART_FRAME_ROWS  1 // Bytes are 8-pixel runs of a row, MSB on the left (ST7920)
+
+extern SCHED_Event USART_Serial_Event;
+
 void USART_Serial_Begin(uint32_t baud_rate);
 void USART_Serial_Print(const char *format, ...);
+void USART_Serial_Write(const uint8_t *data, uint16_t length);
+int USART_Serial_Read(void);
+void USART_Serial_SendFrame(uint8_t layout, uint16_t width, uint16_t height, const uint8_t *data, uint16_t length);
+void EXTI9_5_IRQHandler(void);
 
 #endif
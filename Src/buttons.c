@@ -1,4 +1,5 @@
 #include "buttons.h"
+#include "power.h"
 
 // Delay values for button press detection
 #define TIM2_PRESCALER_VALUE 16000
@@ -14,7 +15,11 @@ volatile uint8_t BUTTON_RightState = 0;
 volatile uint8_t BUTTON_LeftState = 0;
 volatile uint8_t BUTTON_Switch = 0;
 
+// Posted on each press and repetition, its handler is set by the application
+SCHED_Event BUTTONS_Event = { 0 };
+
 static uint8_t begin = 0;
+static uint8_t held = 0; // Top or bottom button down, TIM2 needs its clock for the repetition
 
 // Initialize GPIO for buttons
 static void BUTTONS_InitGPIO(void)
@@ -50,8 +55,12 @@ static void BUTTONS_InitGPIO(void)
 	EXTI->RTSR |= EXTI_RTSR_TR3;
 	EXTI->IMR |= EXTI_IMR_MR3;
 
-	// Switch (PE0)
+	// Switch (PE0), both edges
 	GPIOE->MODER &= ~GPIO_MODER_MODER0;
+	SYSCFG->EXTICR[0] |= SYSCFG_EXTICR1_EXTI0_PE;
+	EXTI->RTSR |= EXTI_RTSR_TR0;
+	EXTI->FTSR |= EXTI_FTSR_TR0;
+	EXTI->IMR |= EXTI_IMR_MR0;
 }
 
 // Initialize interrupts for buttons
@@ -66,6 +75,8 @@ static void BUTTONS_InitInterrupts(void)
 	NVIC_EnableIRQ(EXTI4_IRQn);
 	NVIC_SetPriority(EXTI3_IRQn, 3);
 	NVIC_EnableIRQ(EXTI3_IRQn);
+	NVIC_SetPriority(EXTI0_IRQn, 3);
+	NVIC_EnableIRQ(EXTI0_IRQn);
 }
 
 // Initialize TIM2 for button repetition
@@ -86,15 +97,27 @@ static void BUTTONS_InitTIM2(void)
 	NVIC_EnableIRQ(TIM2_IRQn); // Enable TIM2 interrupt in NVIC
 }
 
+// Keep Stop mode away while a button may be held (released by TIM2)
+static void BUTTONS_Hold(void)
+{
+	if (!held)
+	{
+		held = 1;
+		POWER_Lock();
+	}
+}
+
 // EXTI interrupt handler for Top Button
 void EXTI15_10_IRQHandler(void)
 {
 	if (EXTI->PR & EXTI_PR_PR11)
 	{
 		RESET_TIM2_COUNTER; // Reset TIM2 counter
-		EXTI->PR |= EXTI_PR_PR11; // Clear interrupt flag
+		EXTI->PR = EXTI_PR_PR11; // Clear interrupt flag
 		BUTTON_TopState = 1; // Set Top Button state
+		SCHED_Post(&BUTTONS_Event);
 		begin = 1;
+		BUTTONS_Hold();
 	}
 }
 
@@ -104,9 +127,11 @@ void EXTI2_IRQHandler(void)
 	if (EXTI->PR & EXTI_PR_PR2)
 	{
 		RESET_TIM2_COUNTER; // Reset TIM2 counter
-		EXTI->PR |= EXTI_PR_PR2; // Clear interrupt flag
+		EXTI->PR = EXTI_PR_PR2; // Clear interrupt flag
 		BUTTON_BottomState = 1; // Set Right Button state
+		SCHED_Post(&BUTTONS_Event);
 		begin = 1;
+		BUTTONS_Hold();
 	}
 }
 
@@ -115,8 +140,9 @@ void EXTI4_IRQHandler(void)
 {
 	if (EXTI->PR & EXTI_PR_PR4)
 	{
-		EXTI->PR |= EXTI_PR_PR4; // Clear interrupt flag
+		EXTI->PR = EXTI_PR_PR4; // Clear interrupt flag
 		BUTTON_RightState = 1; // Set Bottom Button state
+		SCHED_Post(&BUTTONS_Event);
 	}
 }
 
@@ -125,8 +151,20 @@ void EXTI3_IRQHandler(void)
 {
 	if (EXTI->PR & EXTI_PR_PR3)
 	{
-		EXTI->PR |= EXTI_PR_PR3; // Clear interrupt flag
+		EXTI->PR = EXTI_PR_PR3; // Clear interrupt flag
 		BUTTON_LeftState = 1; // Set Left Button state
+		SCHED_Post(&BUTTONS_Event);
+	}
+}
+
+// EXTI interrupt handler for the Switch
+void EXTI0_IRQHandler(void)
+{
+	if (EXTI->PR & EXTI_PR_PR0)
+	{
+		EXTI->PR = EXTI_PR_PR0; // Clear interrupt flag
+		BUTTONS_KeyState();
+		SCHED_Post(&BUTTONS_Event);
 	}
 }
 
@@ -146,6 +184,7 @@ void TIM2_IRQHandler(void)
 		if ((GPIOD->IDR & GPIO_IDR_ID11) && !(GPIOE->IDR & GPIO_IDR_ID2))
 		{
 			BUTTON_TopState = 1; // Top button pressed
+			SCHED_Post(&BUTTONS_Event);
 			if (begin) // If this is the first time you press and hold the button
 			{
 				TIM2->ARR = TIM2_INCREMENT_DELAY_VALUE - 1; // Set auto-reload value for repetition
@@ -155,6 +194,7 @@ void TIM2_IRQHandler(void)
 		else if ((GPIOE->IDR & GPIO_IDR_ID2) && !(GPIOD->IDR & GPIO_IDR_ID11))
 		{	
 			BUTTON_BottomState = 1; // Bottom button pressed
+			SCHED_Post(&BUTTONS_Event);
 			if (begin) // If this is the first time you press and hold the button
 			{
 				TIM2->ARR = TIM2_INCREMENT_DELAY_VALUE - 1; // Set auto-reload value for repetition
@@ -167,6 +207,11 @@ void TIM2_IRQHandler(void)
 			TIM2->ARR = TIM2_PUSH_DELAY_VALUE - 1; // Set auto-reload value for repetition
 			BUTTON_TopState = 0;
 			BUTTON_BottomState = 0;
+			if (held)
+			{
+				held = 0;
+				POWER_Unlock();
+			}
 		}
 		RESET_TIM2_COUNTER; // Reset TIM2 counter
 	}
@@ -176,6 +221,7 @@ void TIM2_IRQHandler(void)
 void BUTTONS_Init(void)
 {
 	BUTTONS_InitGPIO();
+	BUTTONS_KeyState();
 	BUTTONS_InitInterrupts();
 	BUTTONS_InitTIM2();
 }
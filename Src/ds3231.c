@@ -1,4 +1,9 @@
 #include "ds3231.h"
+#include "tim.h"
+#include "prof.h"
+
+// Posted on each falling edge of the 1 Hz square wave, the time registers have just changed
+SCHED_Event DS3231_SecondEvent = { 0 };
 
 /*******************************************************************
  * @name       :DS3231_Init
@@ -68,11 +73,13 @@ int DS3231_DEC_BCD(unsigned char x)
  * @name       :DS3231_Read
  * @date       :2024-10-22
  * @function   :Read data from DS3231
- * @parameters :memadd, data, length, timeout
+ * @parameters :memadd, data, length, timeout (ms for each phase)
  * @retvalue   :None
 ********************************************************************/
 void DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeout)
 {
+	PROF_ZONE("DS3231_Read");
+
 	// Enable I2C
 	I2C1->CR1 |= I2C_CR1_PE;
 
@@ -85,8 +92,9 @@ void DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeout
 	I2C1->CR2 |= I2C_CR2_START; // Generate start
 
 	// Wait for transfer completion or timeout
-	uint32_t local_timeout = timeout;
-	while (!(I2C1->ISR & I2C_ISR_TC) && --local_timeout)
+	uint32_t deadline = TIM_Deadline(timeout);
+	uint8_t expired = 0;
+	while (!(I2C1->ISR & I2C_ISR_TC) && !(expired = TIM_Expired(deadline)))
 	{
 		// If TX buffer is empty, send the memory address
 		if (I2C1->ISR & I2C_ISR_TXE)
@@ -94,7 +102,7 @@ void DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeout
 			I2C1->TXDR = memadd;
 		}
 	}
-	if (local_timeout == 0) // Exit if timeout occurs
+	if (expired) // Exit if timeout occurs
 	{
 		I2C1->CR1 &= ~I2C_CR1_PE; // Disable I2C
 		return;
@@ -110,8 +118,8 @@ void DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeout
 	I2C1->CR2 |= I2C_CR2_START; // Generate start
 
 	// Wait for stop condition or timeout
-	local_timeout = timeout;
-	while (!(I2C1->ISR & I2C_ISR_STOPF) && --local_timeout)
+	deadline = TIM_Deadline(timeout);
+	while (!(I2C1->ISR & I2C_ISR_STOPF) && !(expired = TIM_Expired(deadline)))
 	{
 		// If RX buffer is not empty
 		if (I2C1->ISR & I2C_ISR_RXNE)
@@ -119,7 +127,7 @@ void DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeout
 			*data++ = I2C1->RXDR; // Read the data and increment the pointer
 		}
 	}
-	if (local_timeout == 0) // Exit if timeout occurs
+	if (expired) // Exit if timeout occurs
 	{
 		I2C1->CR1 &= ~I2C_CR1_PE; // Disable I2C
 		return;
@@ -133,7 +141,7 @@ void DS3231_Read(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeout
  * @name       :DS3231_Write
  * @date       :2024-10-22
  * @function   :Write data to DS3231 memory with timeout
- * @parameters :memadd, data, length, timeout
+ * @parameters :memadd, data, length, timeout (ms)
  * @retvalue   :None
 ********************************************************************/
 void DS3231_Write(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeout)
@@ -152,10 +160,11 @@ void DS3231_Write(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeou
 
 	// Send memory address and data
 	int i = 0;  // Initialize index for data
-	uint32_t local_timeout = timeout;
+	uint32_t deadline = TIM_Deadline(timeout);
+	uint8_t expired = 0;
 
 	// Wait for stop condition or timeout
-	while (!(I2C1->ISR & I2C_ISR_STOPF) && --local_timeout)
+	while (!(I2C1->ISR & I2C_ISR_STOPF) && !(expired = TIM_Expired(deadline)))
 	{
 		// If transmit buffer is empty, send memory address or data
 		if (I2C1->ISR & I2C_ISR_TXE)
@@ -166,7 +175,7 @@ void DS3231_Write(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeou
 	}
 
 	// Check if timeout has occurred
-	if (local_timeout == 0)
+	if (expired)
 	{
 		I2C1->CR1 &= ~I2C_CR1_PE; // Disable I2C if timeout occurs
 		return;
@@ -176,3 +185,50 @@ void DS3231_Write(uint8_t memadd, uint8_t *data, uint8_t length, uint16_t timeou
 	I2C1->CR1 &= ~I2C_CR1_PE;
 }
 
+
+/*******************************************************************
+ * @name       :DS3231_SquareWaveInit
+ * @date       :2026-10-17
+ * @function   :1 Hz square wave on the INT/SQW pin, each falling edge
+ *              (when the seconds change) posts DS3231_SecondEvent
+ * @parameters :None
+ * @retvalue   :None
+********************************************************************/
+void DS3231_SquareWaveInit(void)
+{
+	uint8_t control = DS3231_CONTROL_RESET;
+	DS3231_Read(DS3231_CONTROL, &control, 1, DS3231_TIMEOUT);
+	control &= ~(DS3231_CONTROL_RS | DS3231_CONTROL_INTCN);
+	DS3231_Write(DS3231_CONTROL, &control, 1, DS3231_TIMEOUT);
+
+	// Input with pull-up
+	RCC->AHB1ENR |= DS3231_SQW_CLOCK;
+	DS3231_SQW_PORT->MODER &= ~GPIO_MODER_MODER1;
+	DS3231_SQW_PORT->PUPDR = (DS3231_SQW_PORT->PUPDR & ~GPIO_PUPDR_PUPDR1) | GPIO_PUPDR_PUPDR1_0;
+
+	RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+	SYSCFG->EXTICR[0] = (SYSCFG->EXTICR[0] & ~SYSCFG_EXTICR1_EXTI1) | DS3231_SQW_EXTICR;
+	EXTI->FTSR |= EXTI_FTSR_TR1;
+	EXTI->RTSR &= ~EXTI_RTSR_TR1;
+	EXTI->PR = EXTI_PR_PR1;
+	EXTI->IMR |= EXTI_IMR_MR1;
+
+	NVIC_SetPriority(EXTI1_IRQn, 3);
+	NVIC_EnableIRQ(EXTI1_IRQn);
+}
+
+/*******************************************************************
+ * @name       :EXTI1_IRQHandler
+ * @date       :2026-10-17
+ * @function   :Falling edge of the square wave
+ * @parameters :None
+ * @retvalue   :None
+********************************************************************/
+void EXTI1_IRQHandler(void)
+{
+	if (EXTI->PR & EXTI_PR_PR1)
+	{
+		EXTI->PR = EXTI_PR_PR1;
+		SCHED_Post(&DS3231_SecondEvent);
+	}
+}
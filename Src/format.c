@@ -0,0 +1,171 @@
+#include "format.h"
+
+/*******************************************************************
+ * @name       :FORMAT_Pad
+ * @date       :2026-10-17
+ * @function   :Output a character several times
+ * @parameters :output, context, c, count
+ * @retvalue   :None
+********************************************************************/
+static void FORMAT_Pad(FORMAT_Output output, void *context, char c, int count)
+{
+	while (count-- > 0) output(context, c);
+}
+
+/*******************************************************************
+ * @name       :FORMAT_Integer
+ * @date       :2026-10-17
+ * @function   :Output an unsigned value with sign, width and padding
+ * @parameters :output, context, value, base, upper, negative, width, zero, left
+ * @retvalue   :None
+********************************************************************/
+static void FORMAT_Integer(FORMAT_Output output, void *context, uint32_t value, uint8_t base, uint8_t upper, uint8_t negative, int width, uint8_t zero, uint8_t left)
+{
+	const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+	char reversed[10];
+	int length = 0;
+
+	// Digits in reverse order
+	do
+	{
+		reversed[length++] = digits[value % base];
+		value /= base;
+	} while (value);
+
+	int padding = width - length - negative;
+
+	if (!left && !zero) FORMAT_Pad(output, context, ' ', padding);
+	if (negative) output(context, '-');
+	if (!left && zero) FORMAT_Pad(output, context, '0', padding);
+	while (length) output(context, reversed[--length]);
+	if (left) FORMAT_Pad(output, context, ' ', padding);
+}
+
+/*******************************************************************
+ * @name       :FORMAT_Print
+ * @date       :2026-10-17
+ * @function   :Format a string like printf without intermediate
+ *              buffer. Supports %d %i %u %x %X %c %s %% with flags
+ *              '0' and '-', a width, and %f as a fixed-point value
+ *              with up to FORMAT_MAX_PRECISION decimals (6 by default)
+ * @parameters :output, context, format, args
+ * @retvalue   :None
+********************************************************************/
+void FORMAT_Print(FORMAT_Output output, void *context, const char *format, va_list args)
+{
+	while (*format)
+	{
+		if (*format != '%')
+		{
+			output(context, *format++);
+			continue;
+		}
+		format++;
+
+		// Flags
+		uint8_t zero = 0;
+		uint8_t left = 0;
+		for (;; format++)
+		{
+			if (*format == '0') zero = 1;
+			else if (*format == '-') left = 1;
+			else break;
+		}
+
+		// Width and precision
+		int width = 0;
+		while (*format >= '0' && *format <= '9') width = width * 10 + (*format++ - '0');
+
+		int precision = -1;
+		if (*format == '.')
+		{
+			precision = 0;
+			format++;
+			while (*format >= '0' && *format <= '9') precision = precision * 10 + (*format++ - '0');
+		}
+
+		// Length modifiers (int and long have the same size)
+		while (*format == 'l' || *format == 'h') format++;
+
+		switch (*format)
+		{
+			case 'd':
+			case 'i':
+			{
+				int32_t value = va_arg(args, int32_t);
+				uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+				FORMAT_Integer(output, context, magnitude, 10, 0, value < 0, width, zero, left);
+				break;
+			}
+			case 'u':
+				FORMAT_Integer(output, context, va_arg(args, uint32_t), 10, 0, 0, width, zero, left);
+				break;
+			case 'x':
+			case 'X':
+				FORMAT_Integer(output, context, va_arg(args, uint32_t), 16, *format == 'X', 0, width, zero, left);
+				break;
+			case 'c':
+				if (!left) FORMAT_Pad(output, context, ' ', width - 1);
+				output(context, (char)va_arg(args, int));
+				if (left) FORMAT_Pad(output, context, ' ', width - 1);
+				break;
+			case 's':
+			{
+				const char *string = va_arg(args, const char *);
+				int length = 0;
+				if (!string) string = "(null)";
+				while (string[length] && (precision < 0 || length < precision)) length++;
+				if (!left) FORMAT_Pad(output, context, ' ', width - length);
+				for (int i = 0; i < length; i++) output(context, string[i]);
+				if (left) FORMAT_Pad(output, context, ' ', width - length);
+				break;
+			}
+			case 'f':
+			{
+				// Scaled to an integer and rounded, then split around the point
+				double value = va_arg(args, double);
+				if (precision < 0) precision = FORMAT_MAX_PRECISION;
+				if (precision > FORMAT_MAX_PRECISION) precision = FORMAT_MAX_PRECISION;
+
+				uint32_t scale = 1;
+				for (int i = 0; i < precision; i++) scale *= 10;
+
+				uint8_t negative = (value < 0);
+				uint64_t fixed = (uint64_t)((negative ? -value : value) * scale + 0.5);
+				uint32_t integer = fixed / scale;
+				uint32_t fraction = fixed % scale;
+				negative = negative && fixed;
+
+				// Written length, to pad around the value
+				int length = negative + (precision ? precision + 1 : 0);
+				for (uint32_t rest = integer; ; rest /= 10)
+				{
+					length++;
+					if (rest < 10) break;
+				}
+
+				if (!left && !zero) FORMAT_Pad(output, context, ' ', width - length);
+				if (negative) output(context, '-');
+				if (!left && zero) FORMAT_Pad(output, context, '0', width - length);
+				FORMAT_Integer(output, context, integer, 10, 0, 0, 0, 0, 0);
+				if (precision)
+				{
+					output(context, '.');
+					FORMAT_Integer(output, context, fraction, 10, 0, 0, precision, 1, 0);
+				}
+				if (left) FORMAT_Pad(output, context, ' ', width - length);
+				break;
+			}
+			case '%':
+				output(context, '%');
+				break;
+			default:
+				// Unknown conversion, written as is
+				output(context, '%');
+				if (*format) output(context, *format);
+				break;
+		}
+
+		if (*format) format++;
+	}
+}
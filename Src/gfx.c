@@ -0,0 +1,450 @@
+#include "gfx.h"
+#include "format.h"
+
+// Position and style of the text being printed
+typedef struct
+{
+	const GFX_Display *display;
+	uint8_t color;
+	int16_t x;
+	int16_t y;
+	const Font *font;
+} GFX_TextCursor;
+
+/*******************************************************************
+ * @name       :GFX_SetPixel
+ * @date       :2026-10-17
+ * @function   :Set pixel in buffer, ignored outside the screen
+ * @parameters :display, color, x, y
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_SetPixel(const GFX_Display *display, uint8_t color, int16_t x, int16_t y)
+{
+	if (x >= display->width || y >= display->height || x < 0 || y < 0) return;
+
+	display->PutPixel(color, x, y);
+}
+
+/*******************************************************************
+ * @name       :GFX_Plot
+ * @date       :2026-10-17
+ * @function   :Set pixel, range checked only if clip is set
+ * @parameters :display, color, x, y, clip
+ * @retvalue   :None
+ *******************************************************************/
+static inline void GFX_Plot(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, uint8_t clip)
+{
+	if (clip && (x >= display->width || y >= display->height || x < 0 || y < 0)) return;
+
+	display->PutPixel(color, x, y);
+}
+
+/*******************************************************************
+ * @name       :GFX_FillRect
+ * @date       :2026-10-17
+ * @function   :Fill an area (w x h pixels) clipped to the screen
+ * @parameters :display, color, x, y, w, h
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_FillRect(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	//Clip to the screen
+	if (x < 0) { w += x; x = 0; }
+	if (y < 0) { h += y; y = 0; }
+	if (x + w > display->width) w = display->width - x;
+	if (y + h > display->height) h = display->height - y;
+	if (w <= 0 || h <= 0) return;
+
+	display->FillRect(color, x, y, w, h);
+}
+
+/*******************************************************************
+ * @name       :GFX_DrawHLine
+ * @date       :2026-10-17
+ * @function   :Draw a horizontal line
+ * @parameters :display, color, x, y, w
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_DrawHLine(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, int16_t w)
+{
+	GFX_FillRect(display, color, x, y, w, 1);
+}
+
+/*******************************************************************
+ * @name       :GFX_DrawVLine
+ * @date       :2026-10-17
+ * @function   :Draw a vertical line
+ * @parameters :display, color, x, y, h
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_DrawVLine(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, int16_t h)
+{
+	GFX_FillRect(display, color, x, y, 1, h);
+}
+
+/*******************************************************************
+ * @name       :GFX_DrawLine
+ * @date       :2026-10-17
+ * @function   :Draw a line, clipped to the screen before walking it
+ * @parameters :display, color, x0, y0, x1, y1
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_DrawLine(const GFX_Display *display, uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	//Horizontal and vertical lines are spans
+	if (y0 == y1)
+	{
+		GFX_DrawHLine(display, color, (x0 < x1) ? x0 : x1, y0, ((x1 >= x0) ? x1 - x0 : x0 - x1) + 1);
+		return;
+	}
+	if (x0 == x1)
+	{
+		GFX_DrawVLine(display, color, x0, (y0 < y1) ? y0 : y1, ((y1 >= y0) ? y1 - y0 : y0 - y1) + 1);
+		return;
+	}
+
+	int dx = (x1 >= x0) ? x1 - x0 : x0 - x1;
+	int dy = (y1 >= y0) ? y1 - y0 : y0 - y1;
+	int sx = (x0 < x1) ? 1 : -1;
+	int sy = (y0 < y1) ? 1 : -1;
+
+	//Bresenham takes one pixel per step on the major axis, step i is
+	//at (2*i*minor + major - 1) / (2*major) on the minor axis
+	uint8_t xMajor = (dx >= dy);
+	int major = xMajor ? dx : dy;
+	int minor = xMajor ? dy : dx;
+	int p0 = xMajor ? x0 : y0;
+	int q0 = xMajor ? y0 : x0;
+	int sp = xMajor ? sx : sy;
+	int sq = xMajor ? sy : sx;
+	int pMax = xMajor ? display->width - 1 : display->height - 1;
+	int qMax = xMajor ? display->height - 1 : display->width - 1;
+
+	//Clip the steps once (64-bit products, int16 lines can be 65535 long):
+	//visible range on the major axis...
+	int first = (sp > 0) ? -p0 : p0 - pMax;
+	int last = (sp > 0) ? pMax - p0 : p0;
+	if (first < 0) first = 0;
+	if (last > major) last = major;
+
+	//...and on the minor axis
+	int qFirst = (sq > 0) ? -q0 : q0 - qMax;
+	int qLast = (sq > 0) ? qMax - q0 : q0;
+	if (qLast < 0 || qFirst > minor) return;
+	if (qFirst > 0)
+	{
+		int64_t step = (2 * (int64_t)qFirst * major - major + 2 * minor) / (2 * minor);
+		if (step > first) first = step;
+	}
+	if (qLast < minor)
+	{
+		int64_t step = (2 * (int64_t)(qLast + 1) * major - major) / (2 * minor);
+		if (step < last) last = step;
+	}
+	if (first > last) return;
+
+	//Walk the visible steps only
+	int64_t num = 2 * (int64_t)first * minor + major - 1;
+	int q = num / (2 * major);
+	int rem = num % (2 * major);
+	int p = p0 + sp * first;
+	q = q0 + sq * q;
+
+	for (int i = first; i <= last; i++)
+	{
+		if (xMajor) display->PutPixel(color, p, q);
+		else display->PutPixel(color, q, p);
+
+		p += sp;
+		rem += 2 * minor;
+		if (rem >= 2 * major)
+		{
+			rem -= 2 * major;
+			q += sq;
+		}
+	}
+}
+
+/*******************************************************************
+ * @name       :GFX_DrawRectangle
+ * @date       :2026-10-17
+ * @function   :Draw rectangle
+ * @parameters :display, color, x, y, w, h
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_DrawRectangle(const GFX_Display *display, uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	//Check input parameters
+	if (x >= display->width || y >= display->height) return;
+
+	//Check width and height
+	if ((x + w) >= display->width) w = display->width - x;
+	if ((y + h) >= display->height) h = display->height - y;
+
+	//Draw 4 lines
+	GFX_DrawHLine(display, color, x, y, w + 1);     //Top line
+	GFX_DrawHLine(display, color, x, y + h, w + 1); //Bottom line
+	GFX_DrawVLine(display, color, x, y, h + 1);     //Left line
+	GFX_DrawVLine(display, color, x + w, y, h + 1); //Right line
+}
+
+/*******************************************************************
+ * @name       :GFX_DrawFilledRectangle
+ * @date       :2026-10-17
+ * @function   :Draw filled rectangle
+ * @parameters :display, color, x, y, w, h
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_DrawFilledRectangle(const GFX_Display *display, uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	//Check input parameters
+	if (x >= display->width || y >= display->height) return;
+
+	//Check width and height
+	if ((x + w) >= display->width) w = display->width - x;
+	if ((y + h) >= display->height) h = display->height - y;
+
+	GFX_FillRect(display, color, x, y, w + 1, h + 1);
+}
+
+/*******************************************************************
+ * @name       :GFX_DrawCircle
+ * @date       :2026-10-17
+ * @function   :Draw circle
+ * @parameters :display, color, x0, y0, radius
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_DrawCircle(const GFX_Display *display, uint8_t color, int16_t x0, int16_t y0, uint8_t radius)
+{
+	int x = radius;
+	int y = 0;
+	int err = 0;
+
+	//Clip the whole circle once, only circles crossing an edge check each pixel
+	if (x0 + radius < 0 || x0 - radius >= display->width || y0 + radius < 0 || y0 - radius >= display->height) return;
+	uint8_t clip = (x0 - radius < 0 || x0 + radius >= display->width || y0 - radius < 0 || y0 + radius >= display->height);
+
+	while (x >= y)
+	{
+		GFX_Plot(display, color, x0 + x, y0 + y, clip);
+		GFX_Plot(display, color, x0 - x, y0 + y, clip);
+		GFX_Plot(display, color, x0 + x, y0 - y, clip);
+		GFX_Plot(display, color, x0 - x, y0 - y, clip);
+		GFX_Plot(display, color, x0 + y, y0 + x, clip);
+		GFX_Plot(display, color, x0 - y, y0 + x, clip);
+		GFX_Plot(display, color, x0 + y, y0 - x, clip);
+		GFX_Plot(display, color, x0 - y, y0 - x, clip);
+
+		y++;
+		err += 1 + 2*y;
+
+		if (2*(err - x) + 1 > 0)
+		{
+			x--;
+			err += 1 - 2*x;
+		}
+	}
+}
+
+/*******************************************************************
+ * @name       :GFX_DrawFilledCircle
+ * @date       :2026-10-17
+ * @function   :Draw filled circle with horizontal spans
+ * @parameters :display, color, x0, y0, radius
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_DrawFilledCircle(const GFX_Display *display, uint8_t color, int16_t x0, int16_t y0, int16_t r)
+{
+	int16_t f = 1 - r;
+	int16_t ddF_x = 1;
+	int16_t ddF_y = -2 * r;
+	int16_t x = 0;
+	int16_t y = r;
+
+	//Clip the whole circle once, the spans are clipped by GFX_FillRect
+	if (x0 + r < 0 || x0 - r >= display->width || y0 + r < 0 || y0 - r >= display->height) return;
+
+	GFX_SetPixel(display, color, x0, y0 + r);
+	GFX_SetPixel(display, color, x0, y0 - r);
+	GFX_DrawHLine(display, color, x0 - r, y0, 2 * r + 1);
+
+	while (x < y)
+	{
+		if (f >= 0)
+		{
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+
+		GFX_DrawHLine(display, color, x0 - x, y0 + y, 2 * x + 1);
+		GFX_DrawHLine(display, color, x0 - x, y0 - y, 2 * x + 1);
+
+		GFX_DrawHLine(display, color, x0 - y, y0 + x, 2 * y + 1);
+		GFX_DrawHLine(display, color, x0 - y, y0 - x, 2 * y + 1);
+	}
+}
+
+/*******************************************************************
+ * @name       :GFX_DrawCharacter
+ * @date       :2026-10-17
+ * @function   :Draw a character at specified position, its columns
+ *              are clipped once for the whole character
+ * @parameters :display, color, x, y, font, letterNumberAscii
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_DrawCharacter(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumberAscii)
+{
+	const FontGlyph *glyph = FONT_GetGlyph(font, letterNumberAscii);
+	if (!glyph) return;
+
+	const uint8_t *letter = &font->data[glyph->offset];
+	uint8_t letterSize = glyph->width;
+
+	int16_t firstColumn = (x < 0) ? -x : 0;
+	int16_t lastColumn = (x + letterSize > display->width) ? display->width - x : letterSize;
+	if (firstColumn >= lastColumn) return;
+
+	if (display->DrawGlyph)
+	{
+		display->DrawGlyph(color, x, y, letter, font->bytesPerColums, firstColumn, lastColumn);
+		return;
+	}
+
+	int16_t firstRow = (y < 0) ? -y : 0;
+	int16_t lastRow = (y + 8 * font->bytesPerColums > display->height) ? display->height - y : 8 * font->bytesPerColums;
+
+	for (int column = firstColumn; column < lastColumn; column++)
+	{
+		for (int byteColumn = firstRow / 8; byteColumn < (lastRow + 7) / 8; byteColumn++)
+		{
+			uint8_t data = letter[byteColumn + font->bytesPerColums * column];
+			for (int bit = 0; data; bit++, data >>= 1)
+			{
+				int16_t row = bit + 8 * byteColumn;
+				if ((data & 1) && row >= firstRow && row < lastRow) display->PutPixel(color, x + column, y + row);
+			}
+		}
+	}
+}
+
+/*******************************************************************
+ * @name       :GFX_DrawStr
+ * @date       :2026-10-17
+ * @function   :Draw a string, stops at the edge of the screen
+ * @parameters :display, color, x, y, font, content
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_DrawStr(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, const Font *font, const char *content)
+{
+	while (*content && x < display->width && y < display->height)
+	{
+		uint8_t currentChar = *content;
+
+		GFX_DrawCharacter(display, color, x, y, font, currentChar);
+
+		// Create a space between the letters
+		const FontGlyph *glyph = FONT_GetGlyph(font, currentChar);
+		if (glyph) x += glyph->width + font->spacing;
+
+		// Go to next letter
+		content++;
+	}
+}
+
+/*******************************************************************
+ * @name       :GFX_PrintCharacter
+ * @date       :2026-10-17
+ * @function   :Draw one formatted character at the text cursor and
+ *              advance it, characters past the screen are dropped
+ * @parameters :context (text cursor), c
+ * @retvalue   :None
+ *******************************************************************/
+static void GFX_PrintCharacter(void *context, char c)
+{
+	GFX_TextCursor *cursor = context;
+	if (cursor->x >= cursor->display->width || cursor->y >= cursor->display->height) return;
+
+	uint8_t currentChar = c;
+	GFX_DrawCharacter(cursor->display, cursor->color, cursor->x, cursor->y, cursor->font, currentChar);
+
+	// Create a space between the letters
+	const FontGlyph *glyph = FONT_GetGlyph(cursor->font, currentChar);
+	if (glyph) cursor->x += glyph->width + cursor->font->spacing;
+}
+
+/*******************************************************************
+ * @name       :GFX_MeasureCharacter
+ * @date       :2026-10-17
+ * @function   :Advance the text cursor by one character without
+ *              drawing it
+ * @parameters :context (text cursor), c
+ * @retvalue   :None
+ *******************************************************************/
+static void GFX_MeasureCharacter(void *context, char c)
+{
+	GFX_TextCursor *cursor = context;
+
+	const FontGlyph *glyph = FONT_GetGlyph(cursor->font, (uint8_t)c);
+	if (glyph) cursor->x += glyph->width + cursor->font->spacing;
+}
+
+/*******************************************************************
+ * @name       :GFX_Measure
+ * @date       :2026-10-17
+ * @function   :Width in pixels of formatted text, from the glyph
+ *              table only (no buffer is touched)
+ * @parameters :font, format, args
+ * @retvalue   :Width, without the spacing after the last letter
+ *******************************************************************/
+uint16_t GFX_Measure(const Font *font, const char *format, va_list args)
+{
+	GFX_TextCursor cursor = { 0, 0, 0, 0, font };
+
+	FORMAT_Print(GFX_MeasureCharacter, &cursor, format, args);
+	return cursor.x ? cursor.x - font->spacing : 0;
+}
+
+/*******************************************************************
+ * @name       :GFX_MeasureStr
+ * @date       :2026-10-17
+ * @function   :Width in pixels of a string once drawn
+ * @parameters :font, content
+ * @retvalue   :Width, without the spacing after the last letter
+ *******************************************************************/
+uint16_t GFX_MeasureStr(const Font *font, const char *content)
+{
+	GFX_TextCursor cursor = { 0, 0, 0, 0, font };
+
+	while (*content) GFX_MeasureCharacter(&cursor, *content++);
+	return cursor.x ? cursor.x - font->spacing : 0;
+}
+
+/*******************************************************************
+ * @name       :GFX_Print
+ * @date       :2026-10-17
+ * @function   :Draw formatted text aligned on x, streamed straight
+ *              into the buffer. Centered and right aligned text is
+ *              measured first, then drawn from its left edge
+ * @parameters :display, color, x, y, align (GFX_ALIGN_LEFT, _CENTER
+ *              or _RIGHT), font, format, args
+ * @retvalue   :None
+ *******************************************************************/
+void GFX_Print(const GFX_Display *display, uint8_t color, int16_t x, int16_t y, uint8_t align, const Font *font, const char *format, va_list args)
+{
+	if (align != GFX_ALIGN_LEFT)
+	{
+		va_list measureArgs;
+		va_copy(measureArgs, args);
+		uint16_t width = GFX_Measure(font, format, measureArgs);
+		va_end(measureArgs);
+
+		x -= (align == GFX_ALIGN_CENTER) ? width / 2 : width;
+	}
+
+	GFX_TextCursor cursor = { display, color, x, y, font };
+	FORMAT_Print(GFX_PrintCharacter, &cursor, format, args);
+}
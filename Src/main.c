@@ -6,9 +6,10 @@
 #include "urm37.h"
 #include "usart.h"
 #include "esp01.h"
-
-const char *days[] = {"NA", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"}; 
-const char *months[] = {"NA", "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"};
+#include "sched.h"
+#include "power.h"
+#include "prof.h"
+#include "screen.h"
 
 static int8_t DS3231_Second = 0;
 static int8_t DS3231_Minute = 0;
@@ -21,6 +22,50 @@ static int8_t DS3231_Century = 0;
 
 static uint8_t UpdateToDisplay = 0;
 static uint8_t UpdateToSetting = 0;
+static uint8_t DateBackgroundReady = 0;
+static int8_t OrbitMinute = -1;
+
+// Night dimming: contrast from each time of the day, sorted (0 turns the display OFF)
+typedef struct MAIN_DimLevel
+{
+	int8_t hour;
+	int8_t minute;
+	uint8_t contrast;
+} MAIN_DimLevel;
+
+static const MAIN_DimLevel MAIN_DimSchedule[] = { {7, 0, 0xFF}, {21, 0, 0x40}, {23, 0, 0x01} };
+static int16_t DimContrast = -1;
+#define MAIN_FADE_STEPS 40 // 2 s at one frame every 50 ms
+
+// Cadence of the tasks in ms
+#define MAIN_FRAME_PERIOD   50    // Fades, only while one is running
+#define MAIN_CLOCK_PERIOD   1000  // RTC read (without MAIN_CLOCK_SQW, or when its edges stop)
+#define MAIN_CLOCK_WATCHDOG 1500  // Square wave edge missing, back to MAIN_CLOCK_PERIOD
+#define MAIN_SENSOR_PERIOD  1000  // URM37 temperature
+#define MAIN_SENSOR_REPLY   100   // URM37 answer, the clocks are kept running meanwhile
+#define MAIN_LED_PERIOD     500
+#define MAIN_POWER_PERIOD   60000 // Residency report
+#define MAIN_CONSOLE_PERIOD 50    // Console commands, while the console is awake
+#define MAIN_CONSOLE_AWAKE  5000  // Console kept awake after the last byte received
+
+// The screens leave a margin for the burn-in orbit
+#if SH1106_ORBIT_RADIUS > SCREEN_MARGIN
+#error "The screens leave a smaller margin than the orbit radius"
+#endif
+
+// 1: the RTC is read on each tick of the DS3231 1 Hz square wave, with the
+// polling as a fallback if the edges do not come (pin not wired...), 0: every MAIN_CLOCK_PERIOD
+#define MAIN_CLOCK_SQW 1
+
+static SCHED_Timer FrameTimer;
+static SCHED_Timer ClockTimer;
+static SCHED_Timer SensorTimer;
+static SCHED_Timer SensorReplyTimer;
+static SCHED_Timer LedTimer;
+static SCHED_Timer PowerTimer;
+static SCHED_Timer ConsoleTimer;
+static uint32_t ConsoleDeadline = 0;
+static SCHED_Event RedrawEvent;
 
 float temp = 0;
 
@@ -29,9 +74,25 @@ static uint8_t state = 0;
 
 static void MAIN_DisplayDate(void);
 static void MAIN_Settings(void);
+static void MAIN_Dimming(void);
+static void MAIN_Redraw(void *context);
+static void MAIN_Frame(void *context);
+static void MAIN_ReadClock(void *context);
+#if MAIN_CLOCK_SQW
+static void MAIN_ClockTick(void *context);
+#endif
+static void MAIN_Sensor(void *context);
+static void MAIN_SensorReply(void *context);
+static void MAIN_Led(void *context);
+static void MAIN_Power(void *context);
+static void MAIN_ConsoleWake(void *context);
+static void MAIN_Console(void *context);
 
 int main(void) 
 {
+	TIM_Init();
+	PROF_Init();
+	POWER_Init();
 	SH1106_Init();
 	SH1106_ClearBuffer();
 	USART_Serial_Begin(9600); 
@@ -51,41 +112,194 @@ int main(void)
 			DS3231_DEC_BCD(3),
 			DS3231_DEC_BCD(1)};
 
-	DS3231_Write(0x00, dataI, 7, 1000);
+	DS3231_Write(0x00, dataI, 7, DS3231_TIMEOUT);
+	
+	// Each part runs at its own cadence, the screen is redrawn when something changes
+	SCHED_Init();
+	SCHED_EventInit(&RedrawEvent, MAIN_Redraw, 0);
+	SCHED_EventInit(&BUTTONS_Event, MAIN_Redraw, 0);
+	SCHED_TimerInit(&FrameTimer, MAIN_Frame, 0);
+	SCHED_TimerInit(&ClockTimer, MAIN_ReadClock, 0);
+	SCHED_TimerInit(&SensorTimer, MAIN_Sensor, 0);
+	SCHED_TimerInit(&SensorReplyTimer, MAIN_SensorReply, 0);
+	SCHED_TimerInit(&LedTimer, MAIN_Led, 0);
+	SCHED_TimerInit(&PowerTimer, MAIN_Power, 0);
+	SCHED_TimerInit(&ConsoleTimer, MAIN_Console, 0);
+	SCHED_EventInit(&USART_Serial_Event, MAIN_ConsoleWake, 0);
+#if MAIN_CLOCK_SQW
+	// One read and one redraw per second, when the seconds change
+	SCHED_EventInit(&DS3231_SecondEvent, MAIN_ClockTick, 0);
+	DS3231_SquareWaveInit();
+	SCHED_Post(&DS3231_SecondEvent);
+#else
+	SCHED_TimerStart(&ClockTimer, 0, MAIN_CLOCK_PERIOD);
+#endif
+	SCHED_TimerStart(&SensorTimer, 0, MAIN_SENSOR_PERIOD);
+	SCHED_TimerStart(&LedTimer, 0, MAIN_LED_PERIOD);
+	SCHED_TimerStart(&PowerTimer, MAIN_POWER_PERIOD, MAIN_POWER_PERIOD);
+	
+	// Sleeps between the tasks, Stop mode during the longer gaps
+	SCHED_Run();
+}
+
+static void MAIN_ConsoleWake(void *context)
+{
+	(void)context;
 	
-	while (1) 
+	// USART3 does not receive in Stop mode: stay awake while the host talks,
+	// the byte that woke the core up is usually lost (the host sends it again)
+	if (!SCHED_TimerActive(&ConsoleTimer))
 	{
-		SH1106_ClearBuffer();
-		BUTTONS_KeyState();
-		GPIO_DigitalWrite(GPIOB, 7, state);	
-		GPIO_DigitalWrite(GPIOB, 14, !state);	
-		TIM_Wait(50);
-		/*URM37_Measure(URM37_Temperature);
-		temp = URM37_GetTemperature();*/
-		
-		switch (BUTTON_Switch)
-		{
-			case 0:
-				MAIN_DisplayDate();
-				break;
-			case 1:
-				MAIN_Settings();
-				break;
-		}
-		state ^= 1;
-		
-		SH1106_SendBuffer();
+		POWER_Lock();
+		SCHED_TimerStart(&ConsoleTimer, 0, MAIN_CONSOLE_PERIOD);
+	}
+	ConsoleDeadline = TIM_Deadline(MAIN_CONSOLE_AWAKE);
+}
+
+static void MAIN_Console(void *context)
+{
+	(void)context;
+	
+	switch (USART_Serial_Read())
+	{
+		case 'c': // Send the last frame drawn (Tools/fbcapture.py)
+			USART_Serial_SendFrame(USART_FRAME_PAGES, SH1106_WIDTH, SH1106_HEIGHT, SH1106_GetBuffer(), (SH1106_WIDTH * SH1106_HEIGHT) / SH1106_DATA_SIZE);
+			break;
+		case 'p': // Profiler report (PROF_ENABLE)
+			PROF_Report();
+			PROF_Reset();
+			break;
+	}
+	
+	if (TIM_Expired(ConsoleDeadline))
+	{
+		SCHED_TimerStop(&ConsoleTimer);
+		POWER_Unlock();
+	}
+}
+
+static void MAIN_Redraw(void *context)
+{
+	(void)context;
+	PROF_ZONE("MAIN_Redraw");
+	
+	SH1106_RestoreBackground();
+	
+	switch (BUTTON_Switch)
+	{
+		case 0:
+			MAIN_DisplayDate();
+			break;
+		case 1:
+			MAIN_Settings();
+			break;
+	}
+	
+	// Send this frame while the next one is drawn
+	SH1106_Present(0);
+}
+
+static void MAIN_Frame(void *context)
+{
+	(void)context;
+	// One contrast command per frame while a fade is running
+	if (!SH1106_FadeStep()) SCHED_TimerStop(&FrameTimer);
+}
+
+static void MAIN_ReadClock(void *context)
+{
+	(void)context;
+	
+	// The settings screen edits the values, they are written back when it is left
+	if (BUTTON_Switch || UpdateToDisplay) return;
+	
+	uint8_t data[7] = {0};
+	DS3231_Read(0x0,data,7, DS3231_TIMEOUT);
+	DS3231_Second = DS3231_BCD_DEC(data[0] & 0x7F);
+	DS3231_Minute = DS3231_BCD_DEC(data[1]);
+	DS3231_Hour = DS3231_BCD_DEC(data[2] & 0x3F);
+	DS3231_DayWeek = DS3231_BCD_DEC(data[3]);
+	DS3231_DayMonth = DS3231_BCD_DEC(data[4]);
+	DS3231_Month = DS3231_BCD_DEC(data[5]);
+	DS3231_Year = DS3231_BCD_DEC(data[6]);
+	DS3231_Century = DS3231_BCD_DEC(data[5] & 0x80);
+	
+	// Move the picture by one pixel each minute against burn-in
+	if (DS3231_Minute != OrbitMinute)
+	{
+		if (OrbitMinute >= 0) SH1106_OrbitStep();
+		OrbitMinute = DS3231_Minute;
 	}
+	
+	MAIN_Dimming();
+	
+	USART_Serial_Print("%02d:%02d:%02d\r\n", DS3231_Hour, DS3231_Minute, DS3231_Second);
+	SCHED_Post(&RedrawEvent);
+}
+
+#if MAIN_CLOCK_SQW
+static void MAIN_ClockTick(void *context)
+{
+	(void)context;
+	
+	// The clock timer only runs when the edges stop, each edge pushes it back
+	SCHED_TimerStart(&ClockTimer, MAIN_CLOCK_WATCHDOG, MAIN_CLOCK_PERIOD);
+	MAIN_ReadClock(0);
+}
+#endif
+
+static void MAIN_Sensor(void *context)
+{
+	(void)context;
+	// USART2 does not receive in Stop mode
+	if (SCHED_TimerActive(&SensorReplyTimer)) return;
+	POWER_Lock();
+	URM37_Measure((uint8_t *)URM37_Temperature);
+	SCHED_TimerStart(&SensorReplyTimer, MAIN_SENSOR_REPLY, 0);
+}
+
+static void MAIN_SensorReply(void *context)
+{
+	(void)context;
+	temp = URM37_GetTemperature();
+	POWER_Unlock();
+}
+
+static void MAIN_Led(void *context)
+{
+	(void)context;
+	GPIO_DigitalWrite(GPIOB, 7, state);	
+	GPIO_DigitalWrite(GPIOB, 14, !state);	
+	state ^= 1;
+}
+
+static void MAIN_Power(void *context)
+{
+	(void)context;
+	POWER_Residency residency;
+	POWER_GetResidency(&residency);
+	POWER_ResetResidency();
+	
+	USART_Serial_Print("run %lu ms, sleep %lu ms (%lu), stop %lu ms (%lu)\r\n", residency.runMs, residency.sleepMs, residency.sleeps, residency.stopMs, residency.stops);
 }
 
 static void MAIN_DisplayDate(void)
 {
 	UpdateToSetting = 1;
 	
+	// Lines and labels are drawn once, only the values are redrawn each frame
+	if (!DateBackgroundReady)
+	{
+		SH1106_BackgroundBegin();
+		SCREEN_ClockBackground(SH1106_GetDisplay());
+		SH1106_BackgroundEnd();
+		DateBackgroundReady = 1;
+	}
+	
 	if (UpdateToDisplay)
 	{
 		uint8_t dataS[7] = {DS3231_DEC_BCD(DS3231_Second), DS3231_DEC_BCD(DS3231_Minute), DS3231_DEC_BCD(DS3231_Hour), DS3231_DEC_BCD(DS3231_DayWeek), DS3231_DEC_BCD(DS3231_DayMonth), DS3231_DEC_BCD(DS3231_Month), DS3231_DEC_BCD(DS3231_Year)};
-		DS3231_Write(0x00, dataS, 7, 1000);
+		DS3231_Write(0x00, dataS, 7, DS3231_TIMEOUT);
 		
 		BUTTON_TopState = 0;
 		BUTTON_BottomState = 0;
@@ -96,24 +310,29 @@ static void MAIN_DisplayDate(void)
 		UpdateToDisplay = 0;
 	}
 	
-	uint8_t data[7] = {0};
-	DS3231_Read(0x0,data,7, 1000);
-	DS3231_Second = DS3231_BCD_DEC(data[0] & 0x7F);
-	DS3231_Minute = DS3231_BCD_DEC(data[1]);
-	DS3231_Hour = DS3231_BCD_DEC(data[2] & 0x3F);
-	DS3231_DayWeek = DS3231_BCD_DEC(data[3]);
-	DS3231_DayMonth = DS3231_BCD_DEC(data[4]);
-	DS3231_Month = DS3231_BCD_DEC(data[5]);
-	DS3231_Year = DS3231_BCD_DEC(data[6]);
-	DS3231_Century = DS3231_BCD_DEC(data[5] & 0x80);
+	SCREEN_Clock clock = { DS3231_Second, DS3231_Minute, DS3231_Hour, DS3231_DayWeek, DS3231_DayMonth, DS3231_Month, DS3231_Year, DS3231_Century, temp };
+	SCREEN_ClockValues(SH1106_GetDisplay(), &clock);
+}
+
+static void MAIN_Dimming(void)
+{
+	uint8_t count = sizeof(MAIN_DimSchedule) / sizeof(MAIN_DimSchedule[0]);
+	int16_t now = DS3231_Hour * 60 + DS3231_Minute;
 	
-	SH1106_FontPrint(1, 0, 0, &Arial12x12, "Temp: %.1f degrees", temp);
-	SH1106_FontPrint(1, 7, 13, &Arial28x28, "%02d:%02d:%02d", DS3231_Hour, DS3231_Minute, DS3231_Second);
-	USART_Serial_Print("%02d:%02d:%02d\r\n", DS3231_Hour, DS3231_Minute, DS3231_Second);
-	SH1106_FontPrint(1, 0, 39, &Arial12x12, "%s,", days[DS3231_DayWeek]);
-	SH1106_FontPrint(1, 0, 52, &Arial12x12, "%s %d, 2%d%02d", months[DS3231_Month], DS3231_DayMonth, DS3231_Century, DS3231_Year);
-	SH1106_DrawLine(1, 0, 37, 131, 37);
-	SH1106_DrawLine(1, 0, 12, 131, 12);
+	// Before the first time of the day, the last level of the day before is kept
+	uint8_t contrast = MAIN_DimSchedule[count - 1].contrast;
+	for (uint8_t n = 0; n < count; n++)
+	{
+		if (now >= MAIN_DimSchedule[n].hour * 60 + MAIN_DimSchedule[n].minute) contrast = MAIN_DimSchedule[n].contrast;
+	}
+	
+	if (contrast == DimContrast) return;
+	
+	if (contrast) SH1106_FadeTo(contrast, MAIN_FADE_STEPS);
+	else SH1106_FadeOut(MAIN_FADE_STEPS);
+	DimContrast = contrast;
+	
+	if (!SCHED_TimerActive(&FrameTimer)) SCHED_TimerStart(&FrameTimer, 0, MAIN_FRAME_PERIOD);
 }
 
 static void handling(int8_t* data, const char* title, int max, int min)
@@ -132,7 +351,7 @@ static void handling(int8_t* data, const char* title, int max, int min)
 	if (*data > max) *data = min;
 	if (*data < min) *data = max;
 
-	SH1106_FontPrint(1, 0, 13, &Arial12x12, "Setting %s : %d", title, *data);
+	SCREEN_Setting(SH1106_GetDisplay(), title, *data);
 }
 
 static void handlingDay()
@@ -161,7 +380,7 @@ static void handlingDay()
 	if (DS3231_Month == 2 && isLeapYear && DS3231_DayMonth < 0) DS3231_DayMonth = 29;
 	if (DS3231_Month == 2 && !isLeapYear && DS3231_DayMonth < 0) DS3231_DayMonth = 28;
 
-	SH1106_FontPrint(1, 0, 13, &Arial12x12, "Setting day : %d", DS3231_DayMonth);
+	SCREEN_Setting(SH1106_GetDisplay(), "day", DS3231_DayMonth);
 }
 
 static void handlingMonth()
@@ -187,7 +406,7 @@ static void handlingMonth()
 	if (DS3231_Month == 2 && isLeapYear && DS3231_DayMonth > 29) DS3231_DayMonth = 29;                                 //Cas de Fevrier dans les annees bissextiles (29 jours)
 	if (DS3231_Month == 2 && !isLeapYear && DS3231_DayMonth > 28) DS3231_DayMonth = 28;                                //Cas de Fevrier hors annees bissextiles (28 jours)
 
-	SH1106_FontPrint(1, 0, 13, &Arial12x12, "Setting month : %d", DS3231_Month);
+	SCREEN_Setting(SH1106_GetDisplay(), "month", DS3231_Month);
 }
 
 static void handlingYear()
@@ -211,7 +430,7 @@ static void handlingYear()
 	if (DS3231_Month == 2 && isLeapYear && DS3231_DayMonth > 29) DS3231_DayMonth = 29;           // Cas de Fevrier dans les annees bissextiles (29 jours)
 	if (DS3231_Month == 2 && !isLeapYear && DS3231_DayMonth > 28) DS3231_DayMonth = 28;          // Cas de Fevrier hors annees bissextiles (28 jours)
 
-	SH1106_FontPrint(1, 0, 13, &Arial12x12, "Setting year : %d", DS3231_Year);
+	SCREEN_Setting(SH1106_GetDisplay(), "year", DS3231_Year);
 }
 
 static void MAIN_Settings(void)
@@ -226,6 +445,11 @@ static void MAIN_Settings(void)
 		BUTTON_RightState = 0;
 		BUTTON_LeftState = 0;
 		
+		// Empty background for the settings screen
+		SH1106_BackgroundBegin();
+		SH1106_BackgroundEnd();
+		DateBackgroundReady = 0;
+		
 		UpdateToSetting = 0;
 	}
 
@@ -0,0 +1,303 @@
+#include "power.h"
+#include "tim.h"
+#include "spi.h"
+
+// Modules needing their clocks (a reception in progress...), Stop mode is not used meanwhile
+static volatile uint8_t POWER_Locks = 0;
+
+// Residency: start of the count, time asleep in microseconds
+static uint32_t POWER_Start = 0;
+static uint64_t POWER_SleepMicros = 0;
+static uint64_t POWER_StopMicros = 0;
+static uint32_t POWER_Sleeps = 0;
+static uint32_t POWER_Stops = 0;
+
+// Part of the Stop periods below one millisecond, not added to the time base yet (us)
+static uint32_t POWER_StopRemainder = 0;
+
+/*******************************************************************
+ * @name       :POWER_Init
+ * @date       :2026-10-17
+ * @function   :Start the LSI and set up LPTIM1 as the Stop mode
+ *              wake-up timer (EXTI line 23)
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void POWER_Init(void)
+{
+	TIM_Init();
+
+	RCC->APB1ENR |= RCC_APB1ENR_PWREN | RCC_APB1ENR_LPTIM1EN;
+
+	//LSI keeps running in Stop mode
+	RCC->CSR |= RCC_CSR_LSION;
+	while (!(RCC->CSR & RCC_CSR_LSIRDY));
+
+	//LPTIM1 clocked from the LSI
+	RCC->DCKCFGR2 = (RCC->DCKCFGR2 & ~RCC_DCKCFGR2_LPTIM1SEL) | RCC_DCKCFGR2_LPTIM1SEL_0;
+
+	//Prescaler and interrupt can only be set while LPTIM1 is disabled
+	LPTIM1->CR = 0;
+	LPTIM1->CFGR = POWER_WAKE_PRESC << LPTIM_CFGR_PRESC_Pos;
+	LPTIM1->IER = LPTIM_IER_CMPMIE;
+
+	//The compare match wakes the core up through EXTI line 23
+	EXTI->IMR |= EXTI_IMR_MR23;
+	EXTI->RTSR |= EXTI_RTSR_TR23;
+	NVIC_SetPriority(LPTIM1_IRQn, 5);
+	NVIC_EnableIRQ(LPTIM1_IRQn);
+
+	POWER_ResetResidency();
+}
+
+/*******************************************************************
+ * @name       :POWER_Lock
+ * @date       :2026-10-17
+ * @function   :Keep the clocks running, Stop mode is not used until
+ *              the matching POWER_Unlock. Can be called from an
+ *              interrupt
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void POWER_Lock(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	POWER_Locks++;
+	__set_PRIMASK(primask);
+}
+
+/*******************************************************************
+ * @name       :POWER_Unlock
+ * @date       :2026-10-17
+ * @function   :Release a POWER_Lock
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void POWER_Unlock(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (POWER_Locks) POWER_Locks--;
+	__set_PRIMASK(primask);
+}
+
+/*******************************************************************
+ * @name       :POWER_WakeTimerStart
+ * @date       :2026-10-17
+ * @function   :Start LPTIM1 for one compare match after a number of
+ *              counts. Its registers are written through the LSI
+ *              clock domain, each write is waited for
+ * @parameters :counts
+ * @retvalue   :None
+ *******************************************************************/
+static void POWER_WakeTimerStart(uint16_t counts)
+{
+	LPTIM1->CR = LPTIM_CR_ENABLE;
+
+	LPTIM1->ARR = POWER_WAKE_MAX;
+	while (!(LPTIM1->ISR & LPTIM_ISR_ARROK));
+	LPTIM1->CMP = counts;
+	while (!(LPTIM1->ISR & LPTIM_ISR_CMPOK));
+	LPTIM1->ICR = LPTIM_ICR_ARROKCF | LPTIM_ICR_CMPOKCF | LPTIM_ICR_CMPMCF;
+
+	LPTIM1->CR |= LPTIM_CR_SNGSTRT;
+}
+
+/*******************************************************************
+ * @name       :POWER_WakeTimerStop
+ * @date       :2026-10-17
+ * @function   :Stop LPTIM1, the counter is read twice because it
+ *              counts in the LSI clock domain
+ * @parameters :None
+ * @retvalue   :Counts since POWER_WakeTimerStart
+ *******************************************************************/
+static uint16_t POWER_WakeTimerStop(void)
+{
+	uint16_t counts;
+	do counts = LPTIM1->CNT; while (counts != LPTIM1->CNT);
+
+	LPTIM1->CR = 0;
+	LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+	EXTI->PR = EXTI_PR_PR23;
+	NVIC_ClearPendingIRQ(LPTIM1_IRQn);
+
+	return counts;
+}
+
+/*******************************************************************
+ * @name       :POWER_Sleep
+ * @date       :2026-10-17
+ * @function   :Sleep mode until the next interrupt, at the latest
+ *              the next millisecond tick
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+static void POWER_Sleep(void)
+{
+	uint32_t start = TIM_Micros();
+
+	__DSB();
+	__WFI();
+
+	POWER_SleepMicros += TIM_ElapsedMicros(start);
+	POWER_Sleeps++;
+}
+
+/*******************************************************************
+ * @name       :POWER_RestoreClocks
+ * @date       :2026-10-17
+ * @function   :Start again the oscillators stopped in Stop mode (the
+ *              core wakes up on HSI): HSE, then the PLL, then the
+ *              system clock used before
+ * @parameters :cr (RCC->CR), pllcfgr (RCC->PLLCFGR), cfgr (RCC->CFGR)
+ *              and odrdy (over-drive on), read before Stop mode
+ * @retvalue   :None
+ *******************************************************************/
+static void POWER_RestoreClocks(uint32_t cr, uint32_t pllcfgr, uint32_t cfgr, uint32_t odrdy)
+{
+	if (cr & RCC_CR_HSEON)
+	{
+		RCC->CR |= RCC_CR_HSEON;
+		while (!(RCC->CR & RCC_CR_HSERDY));
+	}
+
+	if (cr & RCC_CR_PLLON)
+	{
+		RCC->PLLCFGR = pllcfgr; // Only written while the PLL is off
+		RCC->CR |= RCC_CR_PLLON;
+		while (!(RCC->CR & RCC_CR_PLLRDY));
+	}
+
+	// Stop mode ends the over-drive, enabled again if it was used (above 180 MHz)
+	if (odrdy && !(PWR->CSR1 & PWR_CSR1_ODRDY))
+	{
+		PWR->CR1 |= PWR_CR1_ODEN;
+		while (!(PWR->CSR1 & PWR_CSR1_ODRDY));
+		PWR->CR1 |= PWR_CR1_ODSWEN;
+		while (!(PWR->CSR1 & PWR_CSR1_ODSWRDY));
+	}
+
+	uint32_t sws = cfgr & RCC_CFGR_SWS;
+	if (sws != RCC_CFGR_SWS_HSI)
+	{
+		RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW) | (sws >> (RCC_CFGR_SWS_Pos - RCC_CFGR_SW_Pos));
+		while ((RCC->CFGR & RCC_CFGR_SWS) != sws);
+	}
+}
+
+/*******************************************************************
+ * @name       :POWER_Stop
+ * @date       :2026-10-17
+ * @function   :Stop mode until the wake-up timer, an EXTI line (the
+ *              buttons, the RTC, the console) or another wake-up
+ *              source. SysTick does not run meanwhile, the time base
+ *              is moved on by the wake-up timer counts
+ * @parameters :delay (ms)
+ * @retvalue   :None
+ *******************************************************************/
+static void POWER_Stop(uint32_t delay)
+{
+	uint32_t counts = (uint64_t)delay * POWER_LSI_FREQUENCY / (1000 * POWER_WAKE_PRESCALER);
+	if (counts > POWER_WAKE_MAX) counts = POWER_WAKE_MAX;
+	if (counts < 2)
+	{
+		POWER_Sleep();
+		return;
+	}
+
+	POWER_WakeTimerStart(counts - 1);
+	uint32_t cr = RCC->CR;
+	uint32_t pllcfgr = RCC->PLLCFGR;
+	uint32_t cfgr = RCC->CFGR;
+	uint32_t odrdy = PWR->CSR1 & PWR_CSR1_ODRDY;
+
+	//Stop mode with the low-power regulator and the flash powered down
+	PWR->CR1 = (PWR->CR1 & ~PWR_CR1_PDDS) | PWR_CR1_LPDS | PWR_CR1_FPDS;
+	SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+	__DSB();
+	__WFI();
+	SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+	POWER_RestoreClocks(cr, pllcfgr, cfgr, odrdy);
+
+	uint32_t micros = (uint64_t)POWER_WakeTimerStop() * POWER_WAKE_PRESCALER * 1000000 / POWER_LSI_FREQUENCY;
+
+	// Whole milliseconds to the time base, the rest is kept for the next period
+	POWER_StopRemainder += micros;
+	TIM_Advance(POWER_StopRemainder / 1000);
+	POWER_StopRemainder %= 1000;
+
+	POWER_StopMicros += micros;
+	POWER_Stops++;
+}
+
+/*******************************************************************
+ * @name       :POWER_Idle
+ * @date       :2026-10-17
+ * @function   :Wait with the core stopped. Called with interrupts
+ *              masked once nothing is left to do, a pending interrupt
+ *              still wakes the core up and runs once they are unmasked.
+ *              Stop mode is used for long periods when no transfer
+ *              needs the clocks
+ * @parameters :delay (ms until the next timer is due)
+ * @retvalue   :None
+ *******************************************************************/
+void POWER_Idle(uint32_t delay)
+{
+	if (!delay) return;
+
+	if (delay >= POWER_STOP_MIN && !POWER_Locks && !SPI_IsBusy() && (USART3->ISR & USART_ISR_TC)) POWER_Stop(delay);
+	else POWER_Sleep();
+}
+
+/*******************************************************************
+ * @name       :LPTIM1_IRQHandler
+ * @date       :2026-10-17
+ * @function   :Wake-up timer compare match
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void LPTIM1_IRQHandler(void)
+{
+	LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+	EXTI->PR = EXTI_PR_PR23;
+}
+
+/*******************************************************************
+ * @name       :POWER_GetResidency
+ * @date       :2026-10-17
+ * @function   :Time spent running, sleeping and stopped
+ * @parameters :residency
+ * @retvalue   :None
+ *******************************************************************/
+void POWER_GetResidency(POWER_Residency *residency)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	residency->sleepMs = POWER_SleepMicros / 1000;
+	residency->stopMs = POWER_StopMicros / 1000;
+	residency->runMs = TIM_Elapsed(POWER_Start) - residency->sleepMs - residency->stopMs;
+	residency->sleeps = POWER_Sleeps;
+	residency->stops = POWER_Stops;
+	__set_PRIMASK(primask);
+}
+
+/*******************************************************************
+ * @name       :POWER_ResetResidency
+ * @date       :2026-10-17
+ * @function   :Count the residency from now
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void POWER_ResetResidency(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	POWER_Start = TIM_Millis();
+	POWER_SleepMicros = 0;
+	POWER_StopMicros = 0;
+	POWER_Sleeps = 0;
+	POWER_Stops = 0;
+	__set_PRIMASK(primask);
+}
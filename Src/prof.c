@@ -0,0 +1,112 @@
+#include "prof.h"
+
+#if PROF_ENABLE
+
+#include "usart.h"
+
+// Zones run at least once, in order of their first run
+static PROF_Zone *PROF_Zones = 0;
+static PROF_Zone **PROF_Last = &PROF_Zones;
+
+// Cycles counted by an empty zone, taken off each run
+static uint32_t PROF_Overhead = 0;
+
+/*******************************************************************
+ * @name       :PROF_Init
+ * @date       :2026-10-17
+ * @function   :Start the DWT cycle counter and measure the cost of
+ *              an empty zone
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void PROF_Init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55; // Unlock the DWT registers (Cortex-M7)
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	// Smallest of a few empty runs, the first ones fill the caches
+	static PROF_Zone overhead = { .name = "overhead" };
+	PROF_Overhead = 0;
+	for (uint8_t n = 0; n < 8; n++)
+	{
+		PROF_Scope scope = { &overhead, DWT->CYCCNT };
+		PROF_End(&scope);
+	}
+	PROF_Overhead = overhead.min;
+	PROF_Reset();
+}
+
+/*******************************************************************
+ * @name       :PROF_End
+ * @date       :2026-10-17
+ * @function   :End of a zone run (from PROF_ZONE), adds its cycles
+ *              to the zone
+ * @parameters :scope
+ * @retvalue   :None
+ *******************************************************************/
+void PROF_End(PROF_Scope *scope)
+{
+	uint32_t cycles = DWT->CYCCNT - scope->start;
+	PROF_Zone *zone = scope->zone;
+
+	cycles = cycles > PROF_Overhead ? cycles - PROF_Overhead : 0;
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (!zone->listed)
+	{
+		zone->listed = 1;
+		zone->min = 0xFFFFFFFF;
+		*PROF_Last = zone;
+		PROF_Last = &zone->next;
+	}
+	if (cycles < zone->min) zone->min = cycles;
+	if (cycles > zone->max) zone->max = cycles;
+	zone->total += cycles;
+	zone->count++;
+	__set_PRIMASK(primask);
+}
+
+/*******************************************************************
+ * @name       :PROF_Report
+ * @date       :2026-10-17
+ * @function   :Send the statistics of the zones over USART3, in
+ *              cycles (one line per zone)
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void PROF_Report(void)
+{
+	USART_Serial_Print("zone count min mean max (cycles at %lu MHz)\r\n", SystemCoreClock / 1000000);
+
+	for (PROF_Zone *zone = PROF_Zones; zone; zone = zone->next)
+	{
+		if (!zone->count) continue;
+		USART_Serial_Print("%s %lu %lu %lu %lu\r\n", zone->name, zone->count, zone->min, (uint32_t)(zone->total / zone->count), zone->max);
+	}
+}
+
+/*******************************************************************
+ * @name       :PROF_Reset
+ * @date       :2026-10-17
+ * @function   :Clear the statistics, the zones stay listed
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void PROF_Reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	for (PROF_Zone *zone = PROF_Zones; zone; zone = zone->next)
+	{
+		zone->count = 0;
+		zone->min = 0xFFFFFFFF;
+		zone->max = 0;
+		zone->total = 0;
+	}
+	__set_PRIMASK(primask);
+}
+
+#endif
@@ -0,0 +1,299 @@
+#include "sched.h"
+#include "tim.h"
+#include "power.h"
+
+// Timer wheel: timers hashed on their expiry millisecond, last millisecond checked
+static SCHED_Timer *SCHED_Wheel[SCHED_WHEEL_SLOTS];
+static SCHED_Timer *SCHED_Expiring = 0; // Timers of the slot being checked
+static uint32_t SCHED_Now = 0;
+
+// Posted events, in order
+static SCHED_Event *SCHED_Head = 0;
+static SCHED_Event *SCHED_Tail = 0;
+
+/*******************************************************************
+ * @name       :SCHED_Init
+ * @date       :2026-10-17
+ * @function   :Start the time base, timers count from now
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SCHED_Init(void)
+{
+	TIM_Init();
+	SCHED_Now = TIM_Millis();
+}
+
+/*******************************************************************
+ * @name       :SCHED_Insert
+ * @date       :2026-10-17
+ * @function   :Add a timer to the slot of its expiry
+ * @parameters :timer
+ * @retvalue   :None
+ *******************************************************************/
+static void SCHED_Insert(SCHED_Timer *timer)
+{
+	SCHED_Timer **slot = &SCHED_Wheel[timer->expiry & (SCHED_WHEEL_SLOTS - 1)];
+
+	timer->next = *slot;
+	if (*slot) (*slot)->link = &timer->next;
+	*slot = timer;
+	timer->link = slot;
+}
+
+/*******************************************************************
+ * @name       :SCHED_Remove
+ * @date       :2026-10-17
+ * @function   :Take a timer out of its slot
+ * @parameters :timer
+ * @retvalue   :None
+ *******************************************************************/
+static void SCHED_Remove(SCHED_Timer *timer)
+{
+	*timer->link = timer->next;
+	if (timer->next) timer->next->link = timer->link;
+	timer->link = 0;
+}
+
+/*******************************************************************
+ * @name       :SCHED_TimerInit
+ * @date       :2026-10-17
+ * @function   :Set the handler of a stopped timer
+ * @parameters :timer, handler, context (passed to the handler)
+ * @retvalue   :None
+ *******************************************************************/
+void SCHED_TimerInit(SCHED_Timer *timer, SCHED_Handler handler, void *context)
+{
+	timer->handler = handler;
+	timer->context = context;
+	timer->link = 0;
+}
+
+/*******************************************************************
+ * @name       :SCHED_TimerStart
+ * @date       :2026-10-17
+ * @function   :Start or restart a timer. A periodic timer keeps its
+ *              cadence, missed periods are skipped
+ * @parameters :timer, delay (ms to the first run), period (ms, 0 = one-shot)
+ * @retvalue   :None
+ *******************************************************************/
+void SCHED_TimerStart(SCHED_Timer *timer, uint32_t delay, uint32_t period)
+{
+	if (timer->link) SCHED_Remove(timer);
+
+	// The current millisecond may be checked already
+	timer->expiry = TIM_Millis() + delay;
+	if ((int32_t)(timer->expiry - SCHED_Now) <= 0) timer->expiry = SCHED_Now + 1;
+	timer->period = period;
+
+	SCHED_Insert(timer);
+}
+
+/*******************************************************************
+ * @name       :SCHED_TimerStop
+ * @date       :2026-10-17
+ * @function   :Stop a timer, nothing is done if it is not running.
+ *              Can be called from any task or timer handler
+ * @parameters :timer
+ * @retvalue   :None
+ *******************************************************************/
+void SCHED_TimerStop(SCHED_Timer *timer)
+{
+	if (timer->link) SCHED_Remove(timer);
+}
+
+/*******************************************************************
+ * @name       :SCHED_TimerActive
+ * @date       :2026-10-17
+ * @function   :Check if a timer is running
+ * @parameters :timer
+ * @retvalue   :1 if running, 0 otherwise
+ *******************************************************************/
+uint8_t SCHED_TimerActive(const SCHED_Timer *timer)
+{
+	return timer->link != 0;
+}
+
+/*******************************************************************
+ * @name       :SCHED_Expire
+ * @date       :2026-10-17
+ * @function   :Run the timers of a slot that are due at SCHED_Now.
+ *              The slot is moved aside first, timers started by the
+ *              handlers are not run before the next millisecond
+ * @parameters :slot
+ * @retvalue   :1 if a handler ran, 0 otherwise
+ *******************************************************************/
+static uint8_t SCHED_Expire(SCHED_Timer **slot)
+{
+	SCHED_Timer *timer;
+	uint8_t ran = 0;
+
+	SCHED_Expiring = *slot;
+	if (SCHED_Expiring) SCHED_Expiring->link = &SCHED_Expiring;
+	*slot = 0;
+
+	while ((timer = SCHED_Expiring) != 0)
+	{
+		SCHED_Remove(timer);
+
+		// Due on a later turn of the wheel
+		if ((int32_t)(SCHED_Now - timer->expiry) < 0)
+		{
+			SCHED_Insert(timer);
+			continue;
+		}
+
+		// Started again before the handler runs, the handler can stop it
+		if (timer->period)
+		{
+			timer->expiry += timer->period;
+			if ((int32_t)(timer->expiry - SCHED_Now) <= 0) timer->expiry = SCHED_Now + timer->period;
+			SCHED_Insert(timer);
+		}
+
+		timer->handler(timer->context);
+		ran = 1;
+	}
+
+	return ran;
+}
+
+/*******************************************************************
+ * @name       :SCHED_EventInit
+ * @date       :2026-10-17
+ * @function   :Set the handler of an event
+ * @parameters :event, handler, context (passed to the handler)
+ * @retvalue   :None
+ *******************************************************************/
+void SCHED_EventInit(SCHED_Event *event, SCHED_Handler handler, void *context)
+{
+	event->handler = handler;
+	event->context = context;
+}
+
+/*******************************************************************
+ * @name       :SCHED_Post
+ * @date       :2026-10-17
+ * @function   :Queue an event for the next poll, can be called from
+ *              an interrupt. An event already queued is not added again
+ * @parameters :event
+ * @retvalue   :None
+ *******************************************************************/
+void SCHED_Post(SCHED_Event *event)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (!event->pending)
+	{
+		event->pending = 1;
+		event->next = 0;
+		if (SCHED_Tail) SCHED_Tail->next = event;
+		else SCHED_Head = event;
+		SCHED_Tail = event;
+	}
+	__set_PRIMASK(primask);
+}
+
+/*******************************************************************
+ * @name       :SCHED_Pop
+ * @date       :2026-10-17
+ * @function   :Take the first posted event, it can be posted again
+ *              from then on
+ * @parameters :None
+ * @retvalue   :Event, or 0 if none is posted
+ *******************************************************************/
+static SCHED_Event *SCHED_Pop(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	SCHED_Event *event = SCHED_Head;
+	if (event)
+	{
+		SCHED_Head = event->next;
+		if (!SCHED_Head) SCHED_Tail = 0;
+		event->pending = 0;
+	}
+	__set_PRIMASK(primask);
+
+	return event;
+}
+
+/*******************************************************************
+ * @name       :SCHED_Poll
+ * @date       :2026-10-17
+ * @function   :Run the posted events, then the timers due since the
+ *              last poll. After a gap longer than the wheel, each
+ *              slot is checked once
+ * @parameters :None
+ * @retvalue   :1 if something ran, 0 otherwise
+ *******************************************************************/
+uint8_t SCHED_Poll(void)
+{
+	SCHED_Event *event;
+	uint8_t ran = 0;
+
+	while ((event = SCHED_Pop()) != 0)
+	{
+		if (event->handler) event->handler(event->context);
+		ran = 1;
+	}
+
+	uint32_t now = TIM_Millis();
+	if (now - SCHED_Now > SCHED_WHEEL_SLOTS) SCHED_Now = now - SCHED_WHEEL_SLOTS;
+
+	while (SCHED_Now != now)
+	{
+		SCHED_Now++;
+		ran |= SCHED_Expire(&SCHED_Wheel[SCHED_Now & (SCHED_WHEEL_SLOTS - 1)]);
+	}
+
+	return ran;
+}
+
+/*******************************************************************
+ * @name       :SCHED_NextDelay
+ * @date       :2026-10-17
+ * @function   :Time until the first timer is due
+ * @parameters :None
+ * @retvalue   :Milliseconds, 0 if a timer is due, 0xFFFFFFFF if none runs
+ *******************************************************************/
+uint32_t SCHED_NextDelay(void)
+{
+	uint32_t now = TIM_Millis();
+	uint32_t delay = 0xFFFFFFFF;
+
+	// Timers are not sorted, slots only sort them within one turn of the wheel
+	for (uint8_t slot = 0; slot < SCHED_WHEEL_SLOTS; slot++)
+	{
+		for (SCHED_Timer *timer = SCHED_Wheel[slot]; timer; timer = timer->next)
+		{
+			int32_t left = timer->expiry - now;
+			if (left <= 0) return 0;
+			if ((uint32_t)left < delay) delay = left;
+		}
+	}
+
+	return delay;
+}
+
+/*******************************************************************
+ * @name       :SCHED_Run
+ * @date       :2026-10-17
+ * @function   :Main loop of the scheduler, does not return. Idles
+ *              until the next timer when nothing ran, an event posted
+ *              meanwhile wakes it up
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SCHED_Run(void)
+{
+	for (;;)
+	{
+		if (SCHED_Poll()) continue;
+
+		// Masked so that an event posted after the check still wakes the core up
+		__disable_irq();
+		if (!SCHED_Head) POWER_Idle(SCHED_NextDelay());
+		__enable_irq();
+	}
+}
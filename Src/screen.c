@@ -0,0 +1,67 @@
+#include "screen.h"
+
+// Drawing area inside the orbit margin: rows wrap around and the columns at
+// the edges leave the screen when the picture moves. The 12-pixel text lines
+// end on row 62 at the bottom (Arial12x12 rows 0..10)
+#define SCREEN_LEFT  SCREEN_MARGIN
+#define SCREEN_RIGHT (SCREEN_WIDTH - 1 - SCREEN_MARGIN)
+#define SCREEN_TOP   SCREEN_MARGIN
+
+static const char *const SCREEN_Days[] = {"NA", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"};
+static const char *const SCREEN_Months[] = {"NA", "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"};
+
+/*******************************************************************
+ * @name       :SCREEN_Print
+ * @date       :2026-10-17
+ * @function   :Draw formatted text
+ * @parameters :display, x, y, align, font, format, ...
+ * @retvalue   :None
+ *******************************************************************/
+static void SCREEN_Print(const GFX_Display *display, int16_t x, int16_t y, uint8_t align, const Font *font, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	GFX_Print(display, 1, x, y, align, font, format, args);
+	va_end(args);
+}
+
+/*******************************************************************
+ * @name       :SCREEN_ClockBackground
+ * @date       :2026-10-17
+ * @function   :Lines and labels of the clock face, drawn once
+ * @parameters :display
+ * @retvalue   :None
+ *******************************************************************/
+void SCREEN_ClockBackground(const GFX_Display *display)
+{
+	GFX_DrawStr(display, 1, SCREEN_LEFT, SCREEN_TOP, &Arial12x12, "Temp:");
+	GFX_DrawLine(display, 1, SCREEN_LEFT, 37, SCREEN_RIGHT, 37);
+	GFX_DrawLine(display, 1, SCREEN_LEFT, 12, SCREEN_RIGHT, 12);
+}
+
+/*******************************************************************
+ * @name       :SCREEN_ClockValues
+ * @date       :2026-10-17
+ * @function   :Values of the clock face, drawn over its background
+ * @parameters :display, clock
+ * @retvalue   :None
+ *******************************************************************/
+void SCREEN_ClockValues(const GFX_Display *display, const SCREEN_Clock *clock)
+{
+	SCREEN_Print(display, SCREEN_LEFT + GFX_MeasureStr(&Arial12x12, "Temp: ") + Arial12x12.spacing, SCREEN_TOP, GFX_ALIGN_LEFT, &Arial12x12, "%.1f degrees", clock->temperature);
+	SCREEN_Print(display, SCREEN_WIDTH / 2, 13, GFX_ALIGN_CENTER, &Arial28x28, "%02d:%02d:%02d", clock->hour, clock->minute, clock->second);
+	SCREEN_Print(display, SCREEN_LEFT, 39, GFX_ALIGN_LEFT, &Arial12x12, "%s,", SCREEN_Days[clock->dayWeek]);
+	SCREEN_Print(display, SCREEN_LEFT, 52, GFX_ALIGN_LEFT, &Arial12x12, "%s %d, 2%d%02d", SCREEN_Months[clock->month], clock->dayMonth, clock->century, clock->year);
+}
+
+/*******************************************************************
+ * @name       :SCREEN_Setting
+ * @date       :2026-10-17
+ * @function   :Page of the settings screen editing one value
+ * @parameters :display, title, value
+ * @retvalue   :None
+ *******************************************************************/
+void SCREEN_Setting(const GFX_Display *display, const char *title, int value)
+{
+	SCREEN_Print(display, SCREEN_LEFT, 13, GFX_ALIGN_LEFT, &Arial12x12, "Setting %s : %d", title, value);
+}
@@ -1,166 +1,935 @@
+#include <string.h>
+
 #include "sh1106.h"
 #include "tim.h"
+#include "spi.h"
+#include "gpio.h"
+#include "prof.h"
+
+// Front/back buffer pair, drawing goes to the back buffer while the front one is sent
+static uint8_t SH1106_Buffers[2][(SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE] __attribute__((aligned(4)));
+static uint8_t *SH1106_Buffer = SH1106_Buffers[0];
+static uint8_t *SH1106_Front = SH1106_Buffers[1];
+
+// Copy of the panel RAM, used to skip unchanged columns during a flush
+static uint8_t SH1106_Shadow[(SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE];
+
+// Columns modified since the last flush, [start, end) for each page
+static uint8_t SH1106_DirtyStart[SH1106_PAGES];
+static uint8_t SH1106_DirtyEnd[SH1106_PAGES];
+
+// Static background layer, copied back under what was drawn on top of it
+static uint8_t SH1106_Background[(SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE] __attribute__((aligned(4)));
+static uint8_t *SH1106_Frame = 0; // Back buffer while the background is rendered
+
+// Columns drawn over the background since the last restore, [start, end) for each page
+static uint8_t SH1106_DrawnStart[SH1106_PAGES];
+static uint8_t SH1106_DrawnEnd[SH1106_PAGES];
+
+// Flush state
+static uint8_t SH1106_FlushStart[SH1106_PAGES];
+static uint8_t SH1106_FlushEnd[SH1106_PAGES];
+static uint8_t SH1106_FlushPage = SH1106_PAGES;
+static const uint8_t *SH1106_FlushBuffer = 0;
+static uint8_t SH1106_ForceFlush = 1; // Panel content unknown after reset
+
+// DMA flush state
+static volatile uint8_t SH1106_DmaBusy = 0;
+static SH1106_FlushCallback SH1106_DmaCallback = 0;
+
+// Burn-in orbit: position in the orbit (the center first) and offset of the picture on the panel
+#define SH1106_ORBIT_CENTER (SH1106_ORBIT_RADIUS * (2 * SH1106_ORBIT_RADIUS + 2))
+static uint8_t SH1106_OrbitIndex = SH1106_ORBIT_CENTER;
+static int8_t SH1106_OffsetX = 0;
+static int8_t SH1106_OffsetY = 0;
+
+// Ticker: text scrolled on the panel outside the framebuffer, in a band of
+// pages (horizontal) or over the whole screen with the start line (vertical)
+static const char *SH1106_TickerText = 0;
+static const Font *SH1106_TickerFont = 0;
+static uint16_t SH1106_TickerNext = 0;     // Next character rendered (horizontal)
+static uint8_t SH1106_TickerUp = 0;
+static uint8_t SH1106_TickerFirstPage = 0;
+static uint8_t SH1106_TickerHeight = 0;    // Pages of the text
+static uint8_t SH1106_TickerPages = 0;     // Pages left out of the flushes
+static uint8_t SH1106_TickerResend = 0;    // Pages to send again at the next step
+static uint8_t SH1106_ScrollRow = 0;       // Vertical scroll of the picture
+static uint16_t SH1106_TickerRow = 0;      // Text row at the top of the screen (vertical)
+static int16_t SH1106_ScratchLine = -1;    // Text line rendered in the scratch (vertical)
+static volatile uint8_t SH1106_TickerBusy = 0;  // Transfers of the step not sent yet
+static volatile uint8_t SH1106_TickerError = 0;
+
+// Columns rendered ahead of the screen (horizontal)
+static uint8_t SH1106_Ring[SH1106_TICKER_RING][SH1106_TICKER_PAGES];
+static uint8_t SH1106_RingRead = 0;
+static uint8_t SH1106_RingWrite = 0;
+
+// Text rendered before it is copied to the ring or to the screen
+static uint8_t SH1106_Scratch[SH1106_TICKER_PAGES][SH1106_WIDTH];
+
+// Column where a horizontal ticker comes in
+#define SH1106_TICKER_EDGE (SH1106_VISIBLE_WIDTH + SH1106_ORBIT_RADIUS - 1)
+
+// SH1106 on the SPI bus: mode 0, CS active low, DC pin
+static SPI_Device SH1106_Spi = { SPI_MODE0, SH1106_SPI_FREQUENCY, SH1106_CS_PORT, SH1106_CS_PIN, 0, SH1106_DC_PORT, SH1106_DC_PIN, 0 };
+
+// Transfers of a flushed window: address commands, then data
+static void SH1106_DmaAddressSent(uint8_t error);
+static void SH1106_DmaWindowSent(uint8_t error);
+static uint8_t SH1106_Address[3];
+static uint8_t SH1106_AddressError = 0;
+static SPI_Transfer SH1106_AddressTransfer = { &SH1106_Spi, SH1106_Address, sizeof(SH1106_Address), SPI_COMMAND, SH1106_DmaAddressSent, 0 };
+static SPI_Transfer SH1106_DataTransfer = { &SH1106_Spi, 0, 0, SPI_DATA, SH1106_DmaWindowSent, 0 };
 
-static uint8_t SH1106_Buffer[(SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE];
+// Contrast fade: contrast and state on the panel, ramp in progress (FadeLength steps)
+static void SH1106_FadeSent(uint8_t error);
+static uint8_t SH1106_Contrast = 0xFF;
+static uint8_t SH1106_DisplayOn = 1;
+static uint8_t SH1106_FadeStart = 0;
+static uint8_t SH1106_FadeTarget = 0;
+static uint16_t SH1106_FadeIndex = 0;
+static uint16_t SH1106_FadeLength = 0;
+static uint8_t SH1106_FadeOff = 0;         // Display OFF at the end of the ramp
+static volatile uint8_t SH1106_FadeBusy = 0;
+static volatile uint8_t SH1106_FadeError = 0;
+static uint8_t SH1106_FadeCommands[4];
+static SPI_Transfer SH1106_FadeTransfer = { &SH1106_Spi, SH1106_FadeCommands, 0, SPI_COMMAND, SH1106_FadeSent, 0 };
+
+// Transfers of a ticker step: address and data of each page sent, then the start line
+static void SH1106_TickerSent(uint8_t error);
+static uint8_t SH1106_TickerAddress[SH1106_PAGES][3];
+static uint8_t SH1106_StartLine;
+static SPI_Transfer SH1106_TickerTransfers[2 * SH1106_PAGES + 1];
 
 /*******************************************************************
- * @name       :SH1106_SpiInit
+ * @name       :SH1106_SendCmd
  * @date       :2024-01-03
- * @function   :SPI Initialization
+ * @function   :Send command
+ * @parameters :cmd
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_SendCmd(uint8_t cmd)
+{
+	SPI_Write(&SH1106_Spi, SPI_COMMAND, &cmd, 1);
+}
+
+/*******************************************************************
+ * @name       :SH1106_SendDoubleCmd
+ * @date       :2024-01-03
+ * @function   :Send double command
+ * @parameters :cmd1, cmd2
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_SendDoubleCmd(uint8_t cmd1, uint8_t cmd2)
+{
+	uint8_t commands[2] = { cmd1, cmd2 };
+	SPI_Write(&SH1106_Spi, SPI_COMMAND, commands, sizeof(commands));
+}
+
+/*******************************************************************
+ * @name       :SH1106_EncodeAddress
+ * @date       :2026-10-17
+ * @function   :Write the commands setting page and column address
+ *              of the next data bytes
+ * @parameters :commands (3 bytes), page, column (buffer column)
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_EncodeAddress(uint8_t *commands, uint8_t page, int16_t column)
+{
+	// XLevelL is the RAM column of the first buffer column, moved by the orbit
+	column += XLevelL + SH1106_OffsetX;
+
+	commands[0] = YLevel+page;
+	commands[1] = SH1106_CMD_COL_LOW | (column & 0x0F);
+	commands[2] = XLevelH | (column >> 4);
+}
+
+/*******************************************************************
+ * @name       :SH1106_MarkDirty
+ * @date       :2026-10-17
+ * @function   :Mark columns of a page as modified since last flush
+ *              and as drawn over the background
+ * @parameters :page, first, last (columns, inclusive)
+ * @retvalue   :None
+ *******************************************************************/
+static inline void SH1106_MarkDirty(uint8_t page, uint8_t first, uint8_t last)
+{
+	if (first < SH1106_DirtyStart[page]) SH1106_DirtyStart[page] = first;
+	if (last >= SH1106_DirtyEnd[page]) SH1106_DirtyEnd[page] = last + 1;
+
+	if (first < SH1106_DrawnStart[page]) SH1106_DrawnStart[page] = first;
+	if (last >= SH1106_DrawnEnd[page]) SH1106_DrawnEnd[page] = last + 1;
+}
+
+/*******************************************************************
+ * @name       :SH1106_MarkAllDirty
+ * @date       :2026-10-17
+ * @function   :Mark the whole buffer as modified since last flush
  * @parameters :None
  * @retvalue   :None
  *******************************************************************/
-static void SH1106_SpiInit(void)
+static void SH1106_MarkAllDirty(void)
 {
-	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN; // enable clock for GPIOA
-	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOCEN; // enable clock for GPIOC
+	for (int page = 0; page < SH1106_PAGES; page++)
+	{
+		SH1106_DirtyStart[page] = 0;
+		SH1106_DirtyEnd[page] = SH1106_WIDTH;
+	}
+}
 
-	// Initialization of pin PA0-DC
-	GPIOA->MODER |= GPIO_MODER_MODER0_0;
-	GPIOA->MODER &= ~GPIO_MODER_MODER0_1;
+/*******************************************************************
+ * @name       :SH1106_FlushBegin
+ * @date       :2026-10-17
+ * @function   :Take the dirty ranges for a new flush
+ * @parameters :buffer (buffer to send)
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_FlushBegin(const uint8_t *buffer)
+{
+	for (int page = 0; page < SH1106_PAGES; page++)
+	{
+		SH1106_FlushStart[page] = SH1106_DirtyStart[page];
+		SH1106_FlushEnd[page] = SH1106_DirtyEnd[page];
+		SH1106_DirtyStart[page] = SH1106_WIDTH;
+		SH1106_DirtyEnd[page] = 0;
+	}
+	SH1106_FlushPage = 0;
+	SH1106_FlushBuffer = buffer;
+}
 
-	// Initialization of pin PC0-CS
-	GPIOC->MODER |= GPIO_MODER_MODER0_0;
-	GPIOC->MODER &= ~GPIO_MODER_MODER0_1;
+/*******************************************************************
+ * @name       :SH1106_FlushNext
+ * @date       :2026-10-17
+ * @function   :Find the next column window to send. Columns already
+ *              holding the same value on the panel are skipped, and
+ *              windows separated by less than SH1106_WINDOW_GAP
+ *              columns are merged (a new window costs 3 commands)
+ * @parameters :page, start, length (window found)
+ * @retvalue   :1 if a window was found, 0 at the end of the flush
+ *******************************************************************/
+static uint8_t SH1106_FlushNext(uint8_t *page, uint8_t *start, uint8_t *length)
+{
+	for (; SH1106_FlushPage < SH1106_PAGES; SH1106_FlushPage++)
+	{
+		uint8_t p = SH1106_FlushPage;
+		if (SH1106_TickerPages & (1 << p)) continue; // Shown by the ticker
 
-	// Initialization of pin PC1-RST
-	GPIOC->MODER |= GPIO_MODER_MODER1_0;
-	GPIOC->MODER &= ~GPIO_MODER_MODER1_1;
+		const uint8_t *buffer = &SH1106_FlushBuffer[p*SH1106_WIDTH];
+		uint8_t *shadow = &SH1106_Shadow[p*SH1106_WIDTH];
+		uint8_t end = SH1106_FlushEnd[p];
+		uint8_t first = SH1106_FlushStart[p];
 
-	// Initialization of pin PA5-SCK
-	GPIOA->MODER |= GPIO_MODER_MODER5_1;
-	GPIOA->MODER &= ~GPIO_MODER_MODER5_0;
+		// Skip unchanged columns
+		while (first < end && !SH1106_ForceFlush && buffer[first] == shadow[first]) first++;
+		if (first >= end) continue;
 
-	// Initialization of pin PA7-MOSI
-	GPIOA->MODER |= GPIO_MODER_MODER7_1;
-	GPIOA->MODER &= ~GPIO_MODER_MODER7_0;
+		// Extend the window until a large enough unchanged gap
+		uint8_t last = first;
+		for (uint8_t n = first + 1; n < end && n <= last + SH1106_WINDOW_GAP + 1; n++)
+		{
+			if (SH1106_ForceFlush || buffer[n] != shadow[n]) last = n;
+		}
 
-	GPIOA->AFR[0] |= SH1106_SPI1_AF << GPIO_AFRL_AFRL5_Pos;
-	GPIOA->AFR[0] |= SH1106_SPI1_AF << GPIO_AFRL_AFRL7_Pos;
+		// The panel will hold the window once it is sent
+		for (uint8_t n = first; n <= last; n++) shadow[n] = buffer[n];
 
-	//Enable clock access to SPI1 module
-	RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+		SH1106_FlushStart[p] = last + 1;
+		*page = p;
+		*start = first;
+		*length = last - first + 1;
+		return 1;
+	}
 
-	//Set MSB first
-	SPI1->CR1 &= ~SPI_CR1_LSBFIRST;
+	SH1106_ForceFlush = 0;
+	return 0;
+}
 
-	//Set mode to MASTER
-	SPI1->CR1 |= SPI_CR1_MSTR;
+/*******************************************************************
+ * @name       :SH1106_SendBuffer
+ * @date       :2024-01-03
+ * @function   :Send the modified parts of the buffer
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_SendBuffer(void)
+{
+	PROF_ZONE("SH1106_SendBuffer");
+	uint8_t page, start, length;
+
+	// Wait for a DMA flush in progress
+	while (SH1106_DmaBusy);
+
+	SH1106_FlushBegin(SH1106_Buffer);
+	while (SH1106_FlushNext(&page, &start, &length))
+	{
+		SH1106_EncodeAddress(SH1106_Address, page, start);
+		SPI_Write(&SH1106_Spi, SPI_COMMAND, SH1106_Address, sizeof(SH1106_Address));
+		SPI_Write(&SH1106_Spi, SPI_DATA, &SH1106_FlushBuffer[page*SH1106_WIDTH+start], length);
+	}
+}
 
-	//Select software slave management by setting SSM=1 and SSI=1
-	SPI1->CR1 |= SPI_CR1_SSM;
-	SPI1->CR1 |= SPI_CR1_SSI;
+/*******************************************************************
+ * @name       :SH1106_DmaStartWindow
+ * @date       :2026-10-17
+ * @function   :Queue the address commands and the data of a window,
+ *              sent back to back with CS held low
+ * @parameters :page, start, length
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_DmaStartWindow(uint8_t page, uint8_t start, uint8_t length)
+{
+	SH1106_EncodeAddress(SH1106_Address, page, start);
 
-	//Set SPI mode to be MODE1 (CPHA0 CPOL0)
-	SPI1->CR1 &= ~SPI_CR1_CPHA;
-	SPI1->CR1 &= ~SPI_CR1_CPOL;
+	SH1106_DataTransfer.data = &SH1106_FlushBuffer[page*SH1106_WIDTH+start];
+	SH1106_DataTransfer.length = length;
 
-	//Set the frequency of SPI to 500kHz
-	SPI1->CR1 |= SPI_CR1_BR_2;
+	SH1106_AddressTransfer.next = &SH1106_DataTransfer;
+	SPI_Submit(&SH1106_AddressTransfer);
+}
 
-	//Enable SPI module
-	SPI1->CR1 |= SPI_CR1_SPE;
+/*******************************************************************
+ * @name       :SH1106_DmaEnd
+ * @date       :2026-10-17
+ * @function   :End of a DMA flush, done or aborted
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_DmaEnd(void)
+{
+	SH1106_DmaBusy = 0;
+	if (SH1106_DmaCallback) SH1106_DmaCallback();
 }
 
 /*******************************************************************
- * @name       :SH1106_SpiTransmit
- * @date       :2024-05-26
- * @function   :Send with spi
- * @parameters :data
+ * @name       :SH1106_DmaNext
+ * @date       :2026-10-17
+ * @function   :Start the next window, or end the flush
+ * @parameters :None
  * @retvalue   :None
  *******************************************************************/
-static void SH1106_SpiTransmit(uint8_t msg, uint16_t timeout)
+static void SH1106_DmaNext(void)
 {
-    uint32_t local_timeout = timeout;
+	uint8_t page, start, length;
 
-    // Wait until TXE is set or timeout occurs
-    while (!(SPI1->SR & SPI_SR_TXE) && --local_timeout);
-    if (local_timeout == 0) return;  // Exit if timeout occurs
+	if (SH1106_FlushNext(&page, &start, &length))
+	{
+		SH1106_DmaStartWindow(page, start, length);
+		return;
+	}
 
-    // Write the data to the data register
-    *(volatile uint8_t*)&SPI1->DR = msg;
+	SH1106_DmaEnd();
+}
 
-    // Reset the timeout counter
-    local_timeout = timeout;
+/*******************************************************************
+ * @name       :SH1106_DmaAddressSent
+ * @date       :2026-10-17
+ * @function   :End of the address commands of a window, an error is
+ *              handled with the window data
+ * @parameters :error (DMA transfer error)
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_DmaAddressSent(uint8_t error)
+{
+	SH1106_AddressError = error;
+}
 
-    // Wait until TXE is set or timeout occurs
-    while (!(SPI1->SR & SPI_SR_TXE) && --local_timeout);
-    if (local_timeout == 0) return;  // Exit if timeout occurs
+/*******************************************************************
+ * @name       :SH1106_DmaWindowSent
+ * @date       :2026-10-17
+ * @function   :End of a window burst, start the next one
+ * @parameters :error (DMA transfer error)
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_DmaWindowSent(uint8_t error)
+{
+	if (error || SH1106_AddressError)
+	{
+		// The panel content is unknown, resend everything next time. The flush
+		// ends here: SH1106_FlushNext would clear SH1106_ForceFlush
+		SH1106_MarkAllDirty();
+		SH1106_ForceFlush = 1;
+		SH1106_FlushPage = SH1106_PAGES;
+		SH1106_DmaEnd();
+		return;
+	}
 
-    // Reset the timeout counter
-    local_timeout = timeout;
+	SH1106_DmaNext();
+}
 
-    // Wait for BUSY flag to reset or timeout occurs
-    while ((SPI1->SR & SPI_SR_BSY) && --local_timeout);
-    if (local_timeout == 0) return;  // Exit if timeout occurs
+/*******************************************************************
+ * @name       :SH1106_SendBufferDMA
+ * @date       :2026-10-17
+ * @function   :Send the modified parts of the buffer with DMA, the
+ *              buffer must not be modified until the flush is finished
+ * @parameters :callback (called at the end of the flush, can be 0)
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_SendBufferDMA(SH1106_FlushCallback callback)
+{
+	// Wait for the previous flush
+	while (SH1106_DmaBusy);
 
-    // Clear OVR flag (Overrun flag) by reading DR and SR registers
-    (void)SPI1->DR;
-    (void)SPI1->SR;
+	SH1106_DmaCallback = callback;
+	SH1106_DmaBusy = 1;
+	SH1106_FlushBegin(SH1106_Buffer);
+	SH1106_DmaNext();
 }
 
 /*******************************************************************
- * @name       :SH1106_SendCmd
- * @date       :2024-01-03
- * @function   :Send command
- * @parameters :cmd
+ * @name       :SH1106_Present
+ * @date       :2026-10-17
+ * @function   :Swap front and back buffers and send the new front
+ *              buffer with DMA. Drawing can continue in the back
+ *              buffer, which starts as a copy of the presented frame
+ * @parameters :callback (called at the end of the flush, can be 0)
  * @retvalue   :None
  *******************************************************************/
-void SH1106_SendCmd(uint8_t cmd)
+void SH1106_Present(SH1106_FlushCallback callback)
 {
-	SH1106_DC_LOW; //Command mode
-	SH1106_CS_LOW;
-	SH1106_SpiTransmit(cmd, SH1106_TIMEOUT);
-	SH1106_CS_HIGH;
+	// Wait until the previous frame is sent to avoid tearing
+	while (SH1106_DmaBusy);
+
+	uint8_t *front = SH1106_Buffer;
+	SH1106_Buffer = SH1106_Front;
+	SH1106_Front = front;
+
+	SH1106_DmaCallback = callback;
+	SH1106_DmaBusy = 1;
+	SH1106_FlushBegin(SH1106_Front);
+
+	// Both buffers only differ in the columns drawn since the last swap
+	for (int page = 0; page < SH1106_PAGES; page++)
+	{
+		uint16_t index = page*SH1106_WIDTH + SH1106_FlushStart[page];
+		if (SH1106_FlushStart[page] < SH1106_FlushEnd[page])
+			memcpy(&SH1106_Buffer[index], &SH1106_Front[index], SH1106_FlushEnd[page] - SH1106_FlushStart[page]);
+	}
+
+	SH1106_DmaNext();
 }
 
 /*******************************************************************
- * @name       :SH1106_SendDoubleCmd
- * @date       :2024-01-03
- * @function   :Send double command
- * @parameters :cmd1, cmd2
+ * @name       :SH1106_IsBusy
+ * @date       :2026-10-17
+ * @function   :Check if a DMA flush is in progress
+ * @parameters :None
+ * @retvalue   :1 if busy, 0 otherwise
+ *******************************************************************/
+uint8_t SH1106_IsBusy(void)
+{
+	return SH1106_DmaBusy;
+}
+
+/*******************************************************************
+ * @name       :SH1106_GetBuffer
+ * @date       :2026-10-17
+ * @function   :Framebuffer being drawn, for a capture. Pages of
+ *              SH1106_WIDTH columns, one byte per column (LSB on top)
+ * @parameters :None
+ * @retvalue   :Framebuffer
+ *******************************************************************/
+const uint8_t *SH1106_GetBuffer(void)
+{
+	return SH1106_Buffer;
+}
+
+/*******************************************************************
+ * @name       :SH1106_SetOffset
+ * @date       :2026-10-17
+ * @function   :Move the picture on the panel without drawing it
+ *              again. Rows are moved by the display start line (one
+ *              command, rows wrap around), columns by the RAM column
+ *              the buffer is written to, so the next flush sends the
+ *              whole buffer once
+ * @parameters :x (columns to the right), y (rows down), both within
+ *              -SH1106_ORBIT_RADIUS..SH1106_ORBIT_RADIUS
  * @retvalue   :None
  *******************************************************************/
-static void SH1106_SendDoubleCmd(uint8_t cmd1, uint8_t cmd2)
+void SH1106_SetOffset(int8_t x, int8_t y)
+{
+	// Wait for a flush written with the current column offset
+	while (SH1106_DmaBusy);
+
+	if (y != SH1106_OffsetY)
+	{
+		// RAM row n is shown on row n - start line
+		SH1106_SendCmd(SH1106_CMD_STARTLINE | ((SH1106_ScrollRow - y) & 0x3F));
+		SH1106_OffsetY = y;
+	}
+
+	if (x == SH1106_OffsetX) return;
+	SH1106_OffsetX = x;
+
+	// Blank the visible columns uncovered on the left
+	static const uint8_t blank[SH1106_ORBIT_RADIUS] = { 0 };
+	for (uint8_t page = 0; x > 0 && page < SH1106_PAGES; page++)
+	{
+		SH1106_EncodeAddress(SH1106_Address, page, -x);
+		SPI_Write(&SH1106_Spi, SPI_COMMAND, SH1106_Address, sizeof(SH1106_Address));
+		SPI_Write(&SH1106_Spi, SPI_DATA, blank, x);
+	}
+
+	// The RAM content is at the old columns, send everything next time
+	SH1106_MarkAllDirty();
+	SH1106_ForceFlush = 1;
+	SH1106_TickerResend = SH1106_TickerPages;
+}
+
+/*******************************************************************
+ * @name       :SH1106_OrbitStep
+ * @date       :2026-10-17
+ * @function   :Move the picture to the next point of its orbit, a
+ *              square of 2 * SH1106_ORBIT_RADIUS + 1 pixels walked
+ *              column by column, up and down alternately. Most steps
+ *              only change the row (one command byte), the column
+ *              changes once per column of the orbit
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_OrbitStep(void)
 {
-	SH1106_SendCmd(cmd1);
-	SH1106_SendCmd(cmd2);
+	const uint8_t size = 2 * SH1106_ORBIT_RADIUS + 1;
+	SH1106_OrbitIndex = (SH1106_OrbitIndex + 1) % (size * size);
+
+	uint8_t column = SH1106_OrbitIndex / size;
+	uint8_t row = SH1106_OrbitIndex % size;
+	if (column & 1) row = size - 1 - row;
+
+	SH1106_SetOffset(column - SH1106_ORBIT_RADIUS, row - SH1106_ORBIT_RADIUS);
 }
 
 /*******************************************************************
- * @name       :SH1106_SendData
- * @date       :2024-01-03
- * @function   :Send data
- * @parameters :data
+ * @name       :SH1106_ScratchPutPixel
+ * @date       :2026-10-17
+ * @function   :Set pixel in the ticker scratch (rasterizer kernel)
+ * @parameters :color, x, y
  * @retvalue   :None
  *******************************************************************/
-static void SH1106_SendData(uint8_t data)
+static void SH1106_ScratchPutPixel(uint8_t color, int16_t x, int16_t y)
 {
-	SH1106_DC_HIGH; //Data mode
-	SH1106_CS_LOW;
-	SH1106_SpiTransmit(data, SH1106_TIMEOUT);
-	SH1106_CS_HIGH;
+	if (color) SH1106_Scratch[y / SH1106_DATA_SIZE][x] |= 1 << (y % SH1106_DATA_SIZE);
+	else SH1106_Scratch[y / SH1106_DATA_SIZE][x] &= ~(1 << (y % SH1106_DATA_SIZE));
 }
 
 /*******************************************************************
- * @name       :SH1106_SendBuffer
- * @date       :2024-01-03
- * @function   :Send buffer
+ * @name       :SH1106_ScratchFillRect
+ * @date       :2026-10-17
+ * @function   :Fill an area of the ticker scratch (rasterizer kernel)
+ * @parameters :color, x, y, w, h
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_ScratchFillRect(uint8_t color, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	for (int16_t row = y; row < y + h; row++)
+		for (int16_t column = x; column < x + w; column++) SH1106_ScratchPutPixel(color, column, row);
+}
+
+// Kernels of the ticker scratch for the shared rasterizer
+static const GFX_Display SH1106_ScratchDisplay = { SH1106_WIDTH, SH1106_TICKER_PAGES * SH1106_DATA_SIZE, SH1106_ScratchPutPixel, SH1106_ScratchFillRect, 0 };
+
+/*******************************************************************
+ * @name       :SH1106_TickerRenderLine
+ * @date       :2026-10-17
+ * @function   :Render a line of the ticker text (up to '\n' or the
+ *              end) at the left of the scratch
+ * @parameters :text
+ * @retvalue   :Width of the line in pixels
+ *******************************************************************/
+static int16_t SH1106_TickerRenderLine(const char *text)
+{
+	const Font *font = SH1106_TickerFont;
+	int16_t x = 0;
+
+	memset(SH1106_Scratch, 0, sizeof(SH1106_Scratch));
+	for (; *text && *text != '\n' && x < SH1106_WIDTH; text++)
+	{
+		const FontGlyph *glyph = FONT_GetGlyph(font, *text);
+		if (!glyph) continue;
+
+		GFX_DrawCharacter(&SH1106_ScratchDisplay, 1, x, 0, font, *text);
+		x += glyph->width + font->spacing;
+	}
+
+	return x;
+}
+
+/*******************************************************************
+ * @name       :SH1106_TickerRenderNext
+ * @date       :2026-10-17
+ * @function   :Render the next character of a horizontal ticker and
+ *              add its columns (spacing included) to the ring, the
+ *              text starts again after its last character
  * @parameters :None
  * @retvalue   :None
  *******************************************************************/
-void SH1106_SendBuffer(void)
+static void SH1106_TickerRenderNext(void)
+{
+	if (!SH1106_TickerText[SH1106_TickerNext]) SH1106_TickerNext = 0;
+
+	// A character missing from the font is a blank column
+	char letter[2] = { SH1106_TickerText[SH1106_TickerNext++], 0 };
+	int16_t width = SH1106_TickerRenderLine(letter);
+	if (!width) width = 1;
+
+	if (width > SH1106_TICKER_RING) width = SH1106_TICKER_RING;
+	for (int16_t column = 0; column < width; column++, SH1106_RingWrite++)
+	{
+		uint8_t *ring = SH1106_Ring[SH1106_RingWrite % SH1106_TICKER_RING];
+		for (uint8_t n = 0; n < SH1106_TickerHeight; n++) ring[n] = SH1106_Scratch[n][column];
+	}
+}
+
+/*******************************************************************
+ * @name       :SH1106_TickerRenderRow
+ * @date       :2026-10-17
+ * @function   :Copy a row of the vertical ticker text into a RAM row
+ *              of the panel copy
+ * @parameters :ramRow, textRow (0 = top of the first line)
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_TickerRenderRow(uint8_t ramRow, uint16_t textRow)
+{
+	int16_t line = textRow / SH1106_TickerFont->height;
+	uint8_t row = textRow % SH1106_TickerFont->height;
+
+	// The scratch holds one line, rendered again when the next one is reached
+	if (line != SH1106_ScratchLine)
+	{
+		const char *text = SH1106_TickerText;
+		for (int16_t n = 0; n < line; n++) text = strchr(text, '\n') + 1;
+		SH1106_TickerRenderLine(text);
+		SH1106_ScratchLine = line;
+	}
+
+	const uint8_t *source = SH1106_Scratch[row / SH1106_DATA_SIZE];
+	uint8_t *destination = &SH1106_Shadow[(ramRow / SH1106_DATA_SIZE) * SH1106_WIDTH];
+	uint8_t sourceBit = 1 << (row % SH1106_DATA_SIZE);
+	uint8_t destinationBit = 1 << (ramRow % SH1106_DATA_SIZE);
+
+	for (uint8_t column = 0; column < SH1106_WIDTH; column++)
+	{
+		if (source[column] & sourceBit) destination[column] |= destinationBit;
+		else destination[column] &= ~destinationBit;
+	}
+}
+
+/*******************************************************************
+ * @name       :SH1106_TickerPeriod
+ * @date       :2026-10-17
+ * @function   :Rows of the vertical ticker text before it starts
+ *              again
+ * @parameters :None
+ * @retvalue   :Lines times the font height
+ *******************************************************************/
+static uint16_t SH1106_TickerPeriod(void)
+{
+	uint16_t lines = 1;
+	for (const char *text = SH1106_TickerText; *text; text++) if (*text == '\n') lines++;
+
+	return lines * SH1106_TickerFont->height;
+}
+
+/*******************************************************************
+ * @name       :SH1106_TickerSent
+ * @date       :2026-10-17
+ * @function   :End of a ticker transfer
+ * @parameters :error (DMA transfer error)
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_TickerSent(uint8_t error)
+{
+	// The pages are sent again by the next step
+	if (error) SH1106_TickerError = 1;
+
+	SH1106_TickerBusy--;
+}
+
+/*******************************************************************
+ * @name       :SH1106_TickerSend
+ * @date       :2026-10-17
+ * @function   :Queue the windowed write of pages from the panel copy,
+ *              and the start line in vertical mode, as one chain
+ * @parameters :pages (mask of the pages to send)
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_TickerSend(uint8_t pages)
+{
+	SPI_Transfer *transfers = SH1106_TickerTransfers;
+	uint8_t count = 0;
+
+	for (uint8_t page = 0; page < SH1106_PAGES; page++)
+	{
+		if (!(pages & (1 << page))) continue;
+
+		SH1106_EncodeAddress(SH1106_TickerAddress[page], page, 0);
+		transfers[count++] = (SPI_Transfer){ &SH1106_Spi, SH1106_TickerAddress[page], 3, SPI_COMMAND, SH1106_TickerSent, 0 };
+		transfers[count++] = (SPI_Transfer){ &SH1106_Spi, &SH1106_Shadow[page * SH1106_WIDTH], SH1106_WIDTH, SPI_DATA, SH1106_TickerSent, 0 };
+	}
+
+	if (SH1106_TickerUp)
+	{
+		SH1106_StartLine = SH1106_CMD_STARTLINE | ((SH1106_ScrollRow - SH1106_OffsetY) & 0x3F);
+		transfers[count++] = (SPI_Transfer){ &SH1106_Spi, &SH1106_StartLine, 1, SPI_COMMAND, SH1106_TickerSent, 0 };
+	}
+
+	if (!count) return;
+	for (uint8_t n = 0; n + 1 < count; n++) transfers[n].next = &transfers[n + 1];
+
+	SH1106_TickerBusy = count;
+	SPI_Submit(transfers);
+}
+
+/*******************************************************************
+ * @name       :SH1106_TickerHorizontal
+ * @date       :2026-10-17
+ * @function   :Start a ticker scrolling text to the left in a band
+ *              of pages, which the framebuffer flushes leave alone.
+ *              Each step only sends these pages
+ * @parameters :page (first page of the band), font, text (kept, looped)
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_TickerHorizontal(uint8_t page, const Font *font, const char *text)
 {
-	for(int i=0; i<SH1106_DATA_SIZE; i++)  
-	{  
-		SH1106_SendCmd(YLevel+i);
-		SH1106_SendCmd(XLevelL);
-		SH1106_SendCmd(XLevelH);
-		for(int n=0; n<SH1106_WIDTH; n++)
+	if (font->bytesPerColums > SH1106_TICKER_PAGES || page + font->bytesPerColums > SH1106_PAGES || !*text) return;
+
+	SH1106_TickerStop();
+
+	SH1106_TickerText = text;
+	SH1106_TickerFont = font;
+	SH1106_TickerNext = 0;
+	SH1106_TickerUp = 0;
+	SH1106_TickerFirstPage = page;
+	SH1106_TickerHeight = font->bytesPerColums;
+	SH1106_TickerPages = ((1 << SH1106_TickerHeight) - 1) << page;
+	SH1106_RingRead = SH1106_RingWrite = 0;
+
+	// The text comes in from the right of an empty band
+	memset(&SH1106_Shadow[page * SH1106_WIDTH], 0, SH1106_TickerHeight * SH1106_WIDTH);
+	SH1106_TickerResend = SH1106_TickerPages;
+}
+
+/*******************************************************************
+ * @name       :SH1106_TickerVertical
+ * @date       :2026-10-17
+ * @function   :Start a ticker scrolling lines of text up over the
+ *              whole screen with the display start line. Each step
+ *              sends the page of the row coming in at the bottom
+ * @parameters :font, text (lines separated by '\n', kept, looped)
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_TickerVertical(const Font *font, const char *text)
+{
+	if (font->bytesPerColums > SH1106_TICKER_PAGES) return;
+
+	SH1106_TickerStop();
+
+	SH1106_TickerText = text;
+	SH1106_TickerFont = font;
+	SH1106_TickerUp = 1;
+	SH1106_TickerHeight = font->bytesPerColums;
+	SH1106_TickerPages = 0xFF;
+	SH1106_TickerRow = 0;
+	SH1106_ScratchLine = -1;
+
+	uint16_t period = SH1106_TickerPeriod();
+	for (uint8_t row = 0; row < SH1106_HEIGHT; row++) SH1106_TickerRenderRow(row, row % period);
+	SH1106_TickerResend = SH1106_TickerPages;
+}
+
+/*******************************************************************
+ * @name       :SH1106_TickerStep
+ * @date       :2026-10-17
+ * @function   :Scroll the ticker by one pixel. Called at the frame
+ *              rate, waits for the previous step if it is not sent
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_TickerStep(void)
+{
+	if (!SH1106_TickerPages) return;
+
+	while (SH1106_TickerBusy);
+
+	// Bytes of a failed transfer can land anywhere in the RAM, everything is sent again
+	if (SH1106_TickerError)
+	{
+		while (SH1106_DmaBusy);
+		SH1106_TickerError = 0;
+		SH1106_TickerResend = SH1106_TickerPages;
+		SH1106_MarkAllDirty();
+		SH1106_ForceFlush = 1;
+	}
+
+	uint8_t pages = SH1106_TickerResend;
+	SH1106_TickerResend = 0;
+
+	if (SH1106_TickerUp)
+	{
+		// The top row goes to the bottom with the row of text after the screen
+		uint16_t period = SH1106_TickerPeriod();
+		uint8_t ramRow = SH1106_ScrollRow;
+
+		SH1106_TickerRenderRow(ramRow, (SH1106_TickerRow + SH1106_HEIGHT) % period);
+		SH1106_TickerRow = (SH1106_TickerRow + 1) % period;
+		SH1106_ScrollRow = (ramRow + 1) % SH1106_HEIGHT;
+		pages |= 1 << (ramRow / SH1106_DATA_SIZE);
+	}
+	else
+	{
+		// The band moves left by one column, the next one comes from the ring.
+		// It enters at the last column shown with the orbit offset
+		if (SH1106_RingRead == SH1106_RingWrite) SH1106_TickerRenderNext();
+		const uint8_t *column = SH1106_Ring[SH1106_RingRead++ % SH1106_TICKER_RING];
+
+		for (uint8_t n = 0; n < SH1106_TickerHeight; n++)
 		{
-			SH1106_SendData(SH1106_Buffer[i*SH1106_WIDTH+n]); 
+			uint8_t *line = &SH1106_Shadow[(SH1106_TickerFirstPage + n) * SH1106_WIDTH];
+			memmove(line, line + 1, SH1106_TICKER_EDGE);
+			line[SH1106_TICKER_EDGE] = column[n];
 		}
+		pages |= SH1106_TickerPages;
 	}
+
+	SH1106_TickerSend(pages);
+}
+
+/*******************************************************************
+ * @name       :SH1106_TickerStop
+ * @date       :2026-10-17
+ * @function   :Stop the ticker, its pages are flushed from the
+ *              framebuffer again
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_TickerStop(void)
+{
+	if (!SH1106_TickerPages) return;
+
+	while (SH1106_TickerBusy);
+
+	if (SH1106_TickerUp)
+	{
+		SH1106_ScrollRow = 0;
+		SH1106_SendCmd(SH1106_CMD_STARTLINE | ((SH1106_ScrollRow - SH1106_OffsetY) & 0x3F));
+	}
+
+	// The panel copy holds the ticker, the next flush replaces it
+	for (uint8_t page = 0; page < SH1106_PAGES; page++)
+	{
+		if (!(SH1106_TickerPages & (1 << page))) continue;
+		SH1106_DirtyStart[page] = 0;
+		SH1106_DirtyEnd[page] = SH1106_WIDTH;
+	}
+	if (SH1106_TickerError)
+	{
+		while (SH1106_DmaBusy);
+		SH1106_MarkAllDirty();
+	}
+	if (SH1106_TickerResend || SH1106_TickerError) SH1106_ForceFlush = 1;
+
+	SH1106_TickerPages = 0;
+	SH1106_TickerResend = 0;
+	SH1106_TickerError = 0;
+}
+
+/*******************************************************************
+ * @name       :SH1106_FadeSent
+ * @date       :2026-10-17
+ * @function   :End of a fade command
+ * @parameters :error (DMA transfer error)
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_FadeSent(uint8_t error)
+{
+	// The next step sends the contrast and the display state again
+	if (error) SH1106_FadeError = 1;
+
+	SH1106_FadeBusy = 0;
+}
+
+/*******************************************************************
+ * @name       :SH1106_FadeTo
+ * @date       :2026-10-17
+ * @function   :Ramp the contrast to a level over a number of
+ *              SH1106_FadeStep calls. A display turned OFF by a fade
+ *              comes back ON at the first step
+ * @parameters :contrast, steps
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_FadeTo(uint8_t contrast, uint16_t steps)
+{
+	SH1106_FadeStart = SH1106_Contrast;
+	SH1106_FadeTarget = contrast;
+	SH1106_FadeIndex = 0;
+	SH1106_FadeLength = steps ? steps : 1;
+	SH1106_FadeOff = 0;
+}
+
+/*******************************************************************
+ * @name       :SH1106_FadeOut
+ * @date       :2026-10-17
+ * @function   :Ramp the contrast down to 0, then turn the display
+ *              OFF (sleep mode). The RAM content is kept
+ * @parameters :steps
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_FadeOut(uint16_t steps)
+{
+	SH1106_FadeTo(0, steps);
+	SH1106_FadeOff = 1;
+}
+
+/*******************************************************************
+ * @name       :SH1106_FadeStep
+ * @date       :2026-10-17
+ * @function   :Next step of the fade, sends the contrast when it
+ *              changes (one command). Called at the frame rate, a step
+ *              waits for the next call if the last command is not sent
+ * @parameters :None
+ * @retvalue   :1 while a fade is in progress, 0 otherwise
+ *******************************************************************/
+uint8_t SH1106_FadeStep(void)
+{
+	if (SH1106_FadeBusy) return SH1106_FadeLength != 0;
+	if (!SH1106_FadeLength && !SH1106_FadeError) return 0;
+
+	uint8_t length = 0;
+	uint8_t on = SH1106_DisplayOn;
+
+	if (SH1106_FadeLength)
+	{
+		SH1106_FadeIndex++;
+		int16_t contrast = SH1106_FadeStart + (int32_t)(SH1106_FadeTarget - SH1106_FadeStart) * SH1106_FadeIndex / SH1106_FadeLength;
+
+		if (contrast != SH1106_Contrast || SH1106_FadeError)
+		{
+			SH1106_FadeCommands[length++] = SH1106_CMD_CONTRAST;
+			SH1106_FadeCommands[length++] = contrast;
+			SH1106_Contrast = contrast;
+		}
+
+		on = SH1106_FadeIndex < SH1106_FadeLength || !SH1106_FadeOff;
+		if (SH1106_FadeIndex == SH1106_FadeLength) SH1106_FadeLength = 0;
+	}
+	else
+	{
+		SH1106_FadeCommands[length++] = SH1106_CMD_CONTRAST;
+		SH1106_FadeCommands[length++] = SH1106_Contrast;
+	}
+
+	// The display is turned ON after the first contrast and OFF after the last one
+	if (on != SH1106_DisplayOn || SH1106_FadeError) SH1106_FadeCommands[length++] = on ? SH1106_CMD_DISP_ON : SH1106_CMD_DISP_OFF;
+	SH1106_DisplayOn = on;
+	SH1106_FadeError = 0;
+
+	if (length)
+	{
+		SH1106_FadeTransfer.length = length;
+		SH1106_FadeBusy = 1;
+		SPI_Submit(&SH1106_FadeTransfer);
+	}
+
+	return SH1106_FadeLength != 0;
 }
 
 /*******************************************************************
@@ -180,97 +949,234 @@ static void SH1106_Reset(void)
 }
 
 /*******************************************************************
- * @name       :SH1106_SetPixel
- * @date       :2024-01-03
- * @function   :Set pixel in buffer
+ * @name       :SH1106_PutPixel
+ * @date       :2026-10-17
+ * @function   :Set pixel in buffer without range check (rasterizer
+ *              kernel, pixels are already inside the screen)
  * @parameters :color, x, y
  * @retvalue   :None
  *******************************************************************/
-void SH1106_SetPixel(uint8_t color, int16_t x, int16_t y) 
+static void SH1106_PutPixel(uint8_t color, int16_t x, int16_t y) 
 {
-	if (x >= SH1106_WIDTH || y >= SH1106_HEIGHT || x < 0 || y < 0) return;
-
 	uint16_t index = (y / SH1106_DATA_SIZE) * SH1106_WIDTH + x;
 	uint8_t bitOffset = y % SH1106_DATA_SIZE;
 
 	if (color) SH1106_Buffer[index] |= (1 << bitOffset);
 	else SH1106_Buffer[index] &= ~(1 << bitOffset);
+
+	SH1106_MarkDirty(y / SH1106_DATA_SIZE, x, x);
 }
 
 /*******************************************************************
- * @name       : SH1106_DrawCharacter
- * @date       : 2024-01-03
- * @function   : Draw a character at specified position
- * @parameters : color, x, y, font, letterNumberAscii
- * @retvalue   : None
+ * @name       :SH1106_FillRect
+ * @date       :2026-10-17
+ * @function   :Fill an area already clipped to the screen (rasterizer
+ *              kernel): one masked byte per column and page, full
+ *              pages are set with memset
+ * @parameters :color, x, y, w, h
+ * @retvalue   :None
  *******************************************************************/
-void SH1106_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumberAscii) 
+static void SH1106_FillRect(uint8_t color, int16_t x, int16_t y, int16_t w, int16_t h)
 {
-	if (letterNumberAscii < font->asciiBegin || letterNumberAscii > font->asciiEnd) return;
-	
-	uint8_t letterNumber = letterNumberAscii - font->asciiOffset;
-	uint16_t index_letterSize = letterNumber * font->datasize;
-	uint8_t letterSize = font->data[index_letterSize];
+	int16_t lastY = y + h - 1;
+	for (int16_t page = y / SH1106_DATA_SIZE; page <= lastY / SH1106_DATA_SIZE; page++)
+	{
+		//Rows of the area inside this page
+		uint8_t mask = 0xFF;
+		if (page == y / SH1106_DATA_SIZE) mask &= 0xFF << (y % SH1106_DATA_SIZE);
+		if (page == lastY / SH1106_DATA_SIZE) mask &= 0xFF >> (7 - lastY % SH1106_DATA_SIZE);
 
-	for (int column = 0; column < letterSize; column++) 
+		uint8_t *line = &SH1106_Buffer[page * SH1106_WIDTH + x];
+		if (mask == 0xFF) memset(line, color ? 0xFF : 0x00, w);
+		else if (color) for (int i = 0; i < w; i++) line[i] |= mask;
+		else for (int i = 0; i < w; i++) line[i] &= ~mask;
+
+		SH1106_MarkDirty(page, x, x + w - 1);
+	}
+}
+
+/*******************************************************************
+ * @name       :SH1106_DrawGlyph
+ * @date       :2026-10-17
+ * @function   :Draw glyph columns first..last-1 (rasterizer kernel).
+ *              Font columns are vertical bytes like the SH1106 pages,
+ *              so each byte is shifted and written into one or two
+ *              pages, pages outside the screen are skipped
+ * @parameters :color, x, y, data, bytesPerColumn, first, last
+ * @retvalue   :None
+ *******************************************************************/
+static void SH1106_DrawGlyph(uint8_t color, int16_t x, int16_t y, const uint8_t *data, uint8_t bytesPerColumn, int16_t first, int16_t last)
+{
+	// Page receiving the top of the character and bit offset inside it
+	int16_t page = y >> 3;
+	uint8_t shift = y & 7;
+
+	for (int byteColumn = 0; byteColumn < bytesPerColumn; byteColumn++, page++) 
 	{
-		for (int byteColumn = 0; byteColumn < font->bytesPerColums; byteColumn++) 
+		uint8_t lowVisible = (page >= 0 && page < SH1106_PAGES);
+		uint8_t highVisible = (shift && page + 1 >= 0 && page + 1 < SH1106_PAGES);
+		if (!lowVisible && !highVisible) continue;
+
+		const uint8_t *source = &data[byteColumn + bytesPerColumn * first];
+		uint8_t *low = &SH1106_Buffer[page * SH1106_WIDTH + x];
+		uint8_t *high = low + SH1106_WIDTH;
+
+		for (int column = first; column < last; column++, source += bytesPerColumn) 
 		{
-			uint16_t index_Buffer = 1 + letterNumber * font->datasize + byteColumn + font->bytesPerColums * column;
-			uint8_t data = font->data[index_Buffer];
-			for (int bit = 0; bit < 8; bit++) 
+			if (!*source) continue;
+			if (lowVisible)
+			{
+				if (color) low[column] |= *source << shift;
+				else low[column] &= ~(*source << shift);
+			}
+			if (highVisible)
 			{
-				uint8_t pixel = (data >> bit) & 1;
-				int16_t a = x + column;
-				int16_t b = y + (bit + 8 * byteColumn);
-				if (pixel) SH1106_SetPixel(color, a, b);
+				if (color) high[column] |= *source >> (8 - shift);
+				else high[column] &= ~(*source >> (8 - shift));
 			}
 		}
+
+		if (lowVisible) SH1106_MarkDirty(page, x + first, x + last - 1);
+		if (highVisible) SH1106_MarkDirty(page + 1, x + first, x + last - 1);
 	}
 }
 
+// Kernels of the SH1106 page layout for the shared rasterizer
+static const GFX_Display SH1106_Display = { SH1106_WIDTH, SH1106_HEIGHT, SH1106_PutPixel, SH1106_FillRect, SH1106_DrawGlyph };
+
 /*******************************************************************
- * @name       : SH1106_DrawStr
- * @date       : 2024-01-03
- * @function   : Set pixel in buffer
- * @parameters : color, x, y, font, content
- * @retvalue   : None
+ * @name       :SH1106_GetDisplay
+ * @date       :2026-10-17
+ * @function   :Rasterizer display drawing into the buffer, for code
+ *              drawing on any GFX_Display
+ * @parameters :None
+ * @retvalue   :Display
  *******************************************************************/
-void SH1106_DrawStr(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format)
+const GFX_Display *SH1106_GetDisplay(void)
 {
-	while (*format && x < SH1106_WIDTH && y < SH1106_HEIGHT) 
-	{
-		uint8_t currentChar = *format;
+	return &SH1106_Display;
+}
 
-		SH1106_DrawCharacter(color, x, y, font, currentChar);
+/*******************************************************************
+ * @name       :SH1106_SetPixel
+ * @date       :2024-01-03
+ * @function   :Set pixel in buffer
+ * @parameters :color, x, y
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_SetPixel(uint8_t color, int16_t x, int16_t y) 
+{
+	GFX_SetPixel(&SH1106_Display, color, x, y);
+}
 
-		// Create a space between the letters
-		uint8_t letterNumber = currentChar - font->asciiOffset;
-		uint16_t index_letterSize = letterNumber * font->datasize;
-		uint8_t letterSize = font->data[index_letterSize];
-		x += letterSize + (font->length / 10);
+/*******************************************************************
+ * @name       :SH1106_DrawCharacter
+ * @date       :2024-01-03
+ * @function   :Draw a character at specified position
+ * @parameters :color, x, y, font, letterNumberAscii
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumberAscii) 
+{
+	GFX_DrawCharacter(&SH1106_Display, color, x, y, font, letterNumberAscii);
+}
 
-		// Go to next letter
-		format++;
-	}
+/*******************************************************************
+ * @name       :SH1106_DrawStr
+ * @date       :2024-01-03
+ * @function   :Draw a string
+ * @parameters :color, x, y, font, content
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_DrawStr(uint8_t color, int16_t x, int16_t y, const Font *font, const char *content)
+{
+	GFX_DrawStr(&SH1106_Display, color, x, y, font, content);
+}
+
+/*******************************************************************
+ * @name       :SH1106_MeasureStr
+ * @date       :2026-10-17
+ * @function   :Width in pixels of a string once drawn
+ * @parameters :font, content
+ * @retvalue   :Width, without the spacing after the last letter
+ *******************************************************************/
+uint16_t SH1106_MeasureStr(const Font *font, const char *content)
+{
+	return GFX_MeasureStr(font, content);
+}
+
+/*******************************************************************
+ * @name       :SH1106_FontMeasure
+ * @date       :2026-10-17
+ * @function   :Width in pixels of formatted text once drawn
+ * @parameters :font, format, ...
+ * @retvalue   :Width, without the spacing after the last letter
+ *******************************************************************/
+uint16_t SH1106_FontMeasure(const Font *font, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	uint16_t width = GFX_Measure(font, format, args);
+	va_end(args);
+
+	return width;
 }
 
 /*******************************************************************
- * @name       : SH1106_FontPrint
- * @date       : 2024-01-03
- * @function   : Set pixel in buffer
- * @parameters : color, x, y, font, content
- * @retvalue   : None
+ * @name       :SH1106_FontPrint
+ * @date       :2024-01-03
+ * @function   :Draw formatted text, streamed straight into the
+ *              buffer without an intermediate string
+ * @parameters :color, x, y, font, format, ...
+ * @retvalue   :None
  *******************************************************************/
 void SH1106_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...) 
 {
+	PROF_ZONE("SH1106_FontPrint");
 	va_list args;
 	va_start(args, format);
-	char formatted_string[50]; 
-	vsprintf(formatted_string, format, args);
+	GFX_Print(&SH1106_Display, color, x, y, GFX_ALIGN_LEFT, font, format, args);
 	va_end(args);
+}
 
-	SH1106_DrawStr(color, x, y, font, formatted_string); 
+/*******************************************************************
+ * @name       :SH1106_FontPrintAligned
+ * @date       :2026-10-17
+ * @function   :Draw formatted text aligned on x
+ * @parameters :color, x, y, align (SH1106_ALIGN_LEFT, _CENTER or
+ *              _RIGHT), font, format, ...
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_FontPrintAligned(uint8_t color, int16_t x, int16_t y, uint8_t align, const Font *font, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	GFX_Print(&SH1106_Display, color, x, y, align, font, format, args);
+	va_end(args);
+}
+
+/*******************************************************************
+ * @name       :SH1106_DrawHLine
+ * @date       :2026-10-17
+ * @function   :Draw a horizontal line
+ * @parameters :color, x, y, w
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_DrawHLine(uint8_t color, int16_t x, int16_t y, int16_t w)
+{
+	GFX_DrawHLine(&SH1106_Display, color, x, y, w);
+}
+
+/*******************************************************************
+ * @name       :SH1106_DrawVLine
+ * @date       :2026-10-17
+ * @function   :Draw a vertical line
+ * @parameters :color, x, y, h
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_DrawVLine(uint8_t color, int16_t x, int16_t y, int16_t h)
+{
+	GFX_DrawVLine(&SH1106_Display, color, x, y, h);
 }
 
 /*******************************************************************
@@ -280,30 +1186,9 @@ void SH1106_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, con
  * @parameters :color, x0, y0, x1, y1
  * @retvalue   :None
  *******************************************************************/
-void SH1106_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) 
+void SH1106_DrawLine(uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1) 
 {
-	int dx = (x1 >= x0) ? x1 - x0 : x0 - x1;
-	int dy = (y1 >= y0) ? y1 - y0 : y0 - y1;
-	int sx = (x0 < x1) ? 1 : -1;
-	int sy = (y0 < y1) ? 1 : -1;
-	int err = dx - dy;
-
-	while(1)
-	{
-		SH1106_SetPixel(color, x0, y0);
-		if (x0 == x1 && y0 == y1) break;
-		int e2 = err + err;
-		if (e2 > -dy)
-		{
-			err -= dy;
-			x0 += sx;
-		}
-		if (e2 < dx)
-		{
-			err += dx;
-			y0 += sy;
-		}
-	}
+	GFX_DrawLine(&SH1106_Display, color, x0, y0, x1, y1);
 }
 
 /*******************************************************************
@@ -315,39 +1200,19 @@ void SH1106_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t
  *******************************************************************/
 void SH1106_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-	//Check input parameters
-	if (x >= SH1106_WIDTH || y >= SH1106_HEIGHT) return;
-
-	//Check width and height
-	if ((x + w) >= SH1106_WIDTH) w = SH1106_WIDTH - x;
-	if ((y + h) >= SH1106_HEIGHT) h = SH1106_HEIGHT - y;
-
-	//Draw 4 lines
-	SH1106_DrawLine(color, x, y, x + w, y);         //Top line
-	SH1106_DrawLine(color, x, y + h, x + w, y + h); //Bottom line
-	SH1106_DrawLine(color, x, y, x, y + h);         //Left line
-	SH1106_DrawLine(color, x + w, y, x + w, y + h); //Right line
+	GFX_DrawRectangle(&SH1106_Display, color, x, y, w, h);
 }
 
 /*******************************************************************
  * @name       :SH1106_DrawFilledRectangle
  * @date       :2024-01-03
- * @function   :Draw rectangle
+ * @function   :Draw filled rectangle
  * @parameters :color, x, y, w, h
  * @retvalue   :None
  *******************************************************************/
 void SH1106_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-	//Check input parameters
-	if (x >= SH1106_WIDTH || y >= SH1106_HEIGHT) return;
-
-	//Check width and height
-	if ((x + w) >= SH1106_WIDTH) w = SH1106_WIDTH - x;
-	if ((y + h) >= SH1106_HEIGHT) h = SH1106_HEIGHT - y;
-
-	//Draw lines
-	for (int i = 0; i <= h; i++)
-		SH1106_DrawLine(color, x, y + i, x + w, y + i);
+	GFX_DrawFilledRectangle(&SH1106_Display, color, x, y, w, h);
 }
 
 /*******************************************************************
@@ -357,37 +1222,9 @@ void SH1106_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t
  * @parameters :color, x0, y0, radius
  * @retvalue   :None
  *******************************************************************/
-void SH1106_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius)
+void SH1106_DrawCircle(uint8_t color, int16_t x0, int16_t y0, uint8_t radius)
 {
-	int x = radius;
-	int y = 0;
-	int err = 0;
-
-	SH1106_SetPixel(color, x0, y0 + radius);
-	SH1106_SetPixel(color, x0, y0 - radius);
-	SH1106_SetPixel(color, x0 + radius, y0);
-	SH1106_SetPixel(color, x0 - radius, y0);
-
-	while (x >= y)
-	{
-		SH1106_SetPixel(color, x0 + x, y0 + y);
-		SH1106_SetPixel(color, x0 - x, y0 + y);
-		SH1106_SetPixel(color, x0 + x, y0 - y);
-		SH1106_SetPixel(color, x0 - x, y0 - y);
-		SH1106_SetPixel(color, x0 + y, y0 + x);
-		SH1106_SetPixel(color, x0 - y, y0 + x);
-		SH1106_SetPixel(color, x0 + y, y0 - x);
-		SH1106_SetPixel(color, x0 - y, y0 - x);
-
-		y++;
-		err += 1 + 2*y;
-
-		if (2*(err - x) + 1 > 0)
-		{
-			x--;
-			err += 1 - 2*x;
-		}
-	}
+	GFX_DrawCircle(&SH1106_Display, color, x0, y0, radius);
 }
 
 /*******************************************************************
@@ -399,36 +1236,7 @@ void SH1106_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius)
  *******************************************************************/
 void SH1106_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r)
 {
-	int16_t f = 1 - r;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * r;
-	int16_t x = 0;
-	int16_t y = r;
-
-	SH1106_SetPixel(color, x0, y0 + r);
-	SH1106_SetPixel(color, x0, y0 - r);
-	SH1106_SetPixel(color, x0 + r, y0);
-	SH1106_SetPixel(color, x0 - r, y0);
-	SH1106_DrawLine(color, x0 - r, y0, x0 + r, y0);
-
-	while (x < y) 
-	{
-		if (f >= 0) 
-		{
-			y--;
-			ddF_y += 2;
-			f += ddF_y;
-		}
-		x++;
-		ddF_x += 2;
-		f += ddF_x;
-		
-		SH1106_DrawLine(color, x0 - x, y0 + y, x0 + x, y0 + y);
-		SH1106_DrawLine(color, + x, y0 - y, x0 - x, y0 - y);
-		
-		SH1106_DrawLine(color, + y, y0 + x, x0 - y, y0 + x);
-		SH1106_DrawLine(color, + y, y0 - x, x0 - y, y0 - x);
-	}
+	GFX_DrawFilledCircle(&SH1106_Display, color, x0, y0, r);
 }
 
 /*******************************************************************
@@ -440,9 +1248,83 @@ void SH1106_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r)
  *******************************************************************/
 void SH1106_ClearBuffer(void)
 {
-	uint16_t bufferSize = (SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE;
-	for (int i=0; i<bufferSize; i++)
-		SH1106_Buffer[i] = 0;
+	memset(SH1106_Buffer, 0, (SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE);
+
+	SH1106_MarkAllDirty();
+	for (int page = 0; page < SH1106_PAGES; page++)
+	{
+		SH1106_DrawnStart[page] = 0;
+		SH1106_DrawnEnd[page] = SH1106_WIDTH;
+	}
+}
+
+/*******************************************************************
+ * @name       :SH1106_BackgroundBegin
+ * @date       :2026-10-17
+ * @function   :Start rendering the static background: the drawing
+ *              functions write to the cleared background layer until
+ *              SH1106_BackgroundEnd. SH1106_Present must not be
+ *              called in between
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_BackgroundBegin(void)
+{
+	SH1106_Frame = SH1106_Buffer;
+	SH1106_Buffer = SH1106_Background;
+
+	memset(SH1106_Background, 0, (SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE);
+}
+
+/*******************************************************************
+ * @name       :SH1106_BackgroundEnd
+ * @date       :2026-10-17
+ * @function   :Stop rendering the background and start the current
+ *              frame again from it
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_BackgroundEnd(void)
+{
+	SH1106_Buffer = SH1106_Frame;
+	memcpy(SH1106_Buffer, SH1106_Background, (SH1106_WIDTH*SH1106_HEIGHT)/SH1106_DATA_SIZE);
+
+	SH1106_MarkAllDirty();
+	for (int page = 0; page < SH1106_PAGES; page++)
+	{
+		SH1106_DrawnStart[page] = SH1106_WIDTH;
+		SH1106_DrawnEnd[page] = 0;
+	}
+}
+
+/*******************************************************************
+ * @name       :SH1106_RestoreBackground
+ * @date       :2026-10-17
+ * @function   :Start a new frame from the background: only the
+ *              columns drawn since the last restore are copied back,
+ *              a 32-bit word at a time. Replaces SH1106_ClearBuffer
+ *              when a background is used
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SH1106_RestoreBackground(void)
+{
+	for (int page = 0; page < SH1106_PAGES; page++)
+	{
+		if (SH1106_DrawnStart[page] >= SH1106_DrawnEnd[page]) continue;
+
+		// Rows are 132 bytes long, so words stay aligned from page to page
+		uint8_t start = SH1106_DrawnStart[page] & ~3;
+		uint8_t end = (SH1106_DrawnEnd[page] + 3) & ~3;
+		const uint32_t *source = (const uint32_t *)&SH1106_Background[page*SH1106_WIDTH + start];
+		uint32_t *destination = (uint32_t *)&SH1106_Buffer[page*SH1106_WIDTH + start];
+
+		for (int word = (end - start) / 4; word > 0; word--) *destination++ = *source++;
+
+		SH1106_MarkDirty(page, start, end - 1);
+		SH1106_DrawnStart[page] = SH1106_WIDTH;
+		SH1106_DrawnEnd[page] = 0;
+	}
 }
 
 /*******************************************************************
@@ -454,8 +1336,11 @@ void SH1106_ClearBuffer(void)
  *******************************************************************/
 void SH1106_Init(void)
 {
-	// Initialize SPI link
-	SH1106_SpiInit();
+	// Initialize SPI bus and add the screen to it
+	SPI_Init();
+	SPI_Register(&SH1106_Spi);
+	// Initialization of the reset pin
+	GPIO_PinMode(SH1106_RST_PORT, SH1106_RST_PIN, OUTPUT);
 	// Wait 200ms
 	TIM_Wait(200);
 	// Reset
@@ -475,7 +1360,7 @@ void SH1106_Init(void)
 	// Set COM pins hardware configuration
 	SH1106_SendDoubleCmd(SH1106_CMD_COM_HW, 0x12);
 	// Set contrast control
-	SH1106_SendDoubleCmd(SH1106_CMD_CONTRAST, 0xFF); // Contrast: middle level
+	SH1106_SendDoubleCmd(SH1106_CMD_CONTRAST, 0xFF); // Contrast: highest level
 	// Disable entire display ON
 	SH1106_SendCmd(SH1106_CMD_EDOFF);
 	// Disable display inversion
@@ -484,4 +1369,18 @@ void SH1106_Init(void)
 	SH1106_SendDoubleCmd(SH1106_CMD_CLOCKDIV, 0x80);
 	// Display ON
 	SH1106_SendCmd(SH1106_CMD_DISP_ON);
+	// Picture at its place, the orbit starts from the center
+	SH1106_OrbitIndex = SH1106_ORBIT_CENTER;
+	SH1106_OffsetX = 0;
+	SH1106_OffsetY = 0;
+	SH1106_TickerPages = 0;
+	SH1106_ScrollRow = 0;
+	// Full contrast, no fade
+	SH1106_Contrast = 0xFF;
+	SH1106_DisplayOn = 1;
+	SH1106_FadeLength = 0;
+	SH1106_FadeError = 0;
+	// The panel RAM is unknown, the first flush sends everything
+	SH1106_MarkAllDirty();
+	SH1106_ForceFlush = 1;
 }
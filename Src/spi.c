@@ -0,0 +1,292 @@
+#include "spi.h"
+#include "gpio.h"
+
+// Transfers waiting for the DMA, the head is the one being sent
+static SPI_Transfer *volatile SPI_Head = 0;
+static SPI_Transfer *SPI_Tail = 0;
+
+static volatile uint8_t SPI_Running = 0; // DMA transfer in progress
+static volatile uint8_t SPI_Locked = 0;  // Blocking write in progress
+static uint8_t SPI_Ready = 0;
+
+// Device whose settings are loaded in SPI1, device whose CS is asserted
+static SPI_Device *SPI_Current = 0;
+static SPI_Device *SPI_Selected = 0;
+
+/*******************************************************************
+ * @name       :SPI_Init
+ * @date       :2026-10-17
+ * @function   :SPI1 (PA5-SCK, PA7-MOSI) and DMA Initialization,
+ *              done once for all the devices on the bus
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void SPI_Init(void)
+{
+	if (SPI_Ready) return;
+
+	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN; // enable clock for GPIOA
+
+	// Initialization of pin PA5-SCK
+	GPIOA->MODER |= GPIO_MODER_MODER5_1;
+	GPIOA->MODER &= ~GPIO_MODER_MODER5_0;
+
+	// Initialization of pin PA7-MOSI
+	GPIOA->MODER |= GPIO_MODER_MODER7_1;
+	GPIOA->MODER &= ~GPIO_MODER_MODER7_0;
+
+	GPIOA->AFR[0] |= SPI_SPI1_AF << GPIO_AFRL_AFRL5_Pos;
+	GPIOA->AFR[0] |= SPI_SPI1_AF << GPIO_AFRL_AFRL7_Pos;
+
+	//Enable clock access to SPI1 module
+	RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+
+	//Master, MSB first, software slave management, enabled on the first transfer
+	SPI1->CR1 = SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI;
+
+	//8-bit frames, RXNE on one byte
+	SPI1->CR2 = (7 << SPI_CR2_DS_Pos) | SPI_CR2_FRXTH;
+
+	//Enable clock access to DMA2
+	RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
+
+	//Disable the stream before configuring it
+	SPI_DMA_STREAM->CR &= ~DMA_SxCR_EN;
+	while (SPI_DMA_STREAM->CR & DMA_SxCR_EN);
+
+	//Channel 3, memory to peripheral, memory increment, byte to byte, interrupt on complete and error
+	SPI_DMA_STREAM->CR = (SPI_DMA_CHANNEL << DMA_SxCR_CHSEL_Pos)
+	                   | DMA_SxCR_DIR_0
+	                   | DMA_SxCR_MINC
+	                   | DMA_SxCR_TCIE
+	                   | DMA_SxCR_TEIE;
+
+	//Destination is the SPI1 data register
+	SPI_DMA_STREAM->PAR = (uint32_t)&SPI1->DR;
+
+	NVIC_SetPriority(SPI_DMA_IRQn, 5);
+	NVIC_EnableIRQ(SPI_DMA_IRQn);
+
+	SPI_Ready = 1;
+}
+
+/*******************************************************************
+ * @name       :SPI_Register
+ * @date       :2026-10-17
+ * @function   :Set up the CS and DC pins of a device and compute its
+ *              SPI1 settings. The prescaler is the smallest one giving
+ *              at most device->frequency from the APB2 clock
+ * @parameters :device
+ * @retvalue   :None
+ *******************************************************************/
+void SPI_Register(SPI_Device *device)
+{
+	GPIO_PinMode(device->csPort, device->csPin, OUTPUT);
+	GPIO_DigitalWrite(device->csPort, device->csPin, !device->csActiveHigh);
+	if (device->dcPort) GPIO_PinMode(device->dcPort, device->dcPin, OUTPUT);
+
+	//SPI1 is on APB2
+	uint32_t clock = SystemCoreClock >> APBPrescTable[(RCC->CFGR & RCC_CFGR_PPRE2) >> RCC_CFGR_PPRE2_Pos];
+	uint8_t baudRate = 0;
+	while (baudRate < 7 && (clock >> (baudRate + 1)) > device->frequency) baudRate++;
+
+	device->cr1 = SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI | (baudRate << SPI_CR1_BR_Pos);
+	if (device->mode & 1) device->cr1 |= SPI_CR1_CPHA;
+	if (device->mode & 2) device->cr1 |= SPI_CR1_CPOL;
+}
+
+/*******************************************************************
+ * @name       :SPI_Deselect
+ * @date       :2026-10-17
+ * @function   :Release the CS of the selected device
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+static void SPI_Deselect(void)
+{
+	if (!SPI_Selected) return;
+
+	GPIO_DigitalWrite(SPI_Selected->csPort, SPI_Selected->csPin, !SPI_Selected->csActiveHigh);
+	SPI_Selected = 0;
+}
+
+/*******************************************************************
+ * @name       :SPI_Select
+ * @date       :2026-10-17
+ * @function   :Load the settings of a device if another one used the
+ *              bus last, then assert its CS and set its DC pin
+ * @parameters :device, dc
+ * @retvalue   :None
+ *******************************************************************/
+static void SPI_Select(SPI_Device *device, uint8_t dc)
+{
+	if (SPI_Selected != device)
+	{
+		SPI_Deselect();
+
+		//Mode and prescaler can only change while SPI1 is disabled
+		if (SPI_Current != device)
+		{
+			SPI1->CR1 &= ~SPI_CR1_SPE;
+			SPI1->CR1 = device->cr1;
+			SPI1->CR1 |= SPI_CR1_SPE;
+			SPI_Current = device;
+		}
+
+		GPIO_DigitalWrite(device->csPort, device->csPin, device->csActiveHigh);
+		SPI_Selected = device;
+	}
+
+	if (device->dcPort) GPIO_DigitalWrite(device->dcPort, device->dcPin, dc);
+}
+
+/*******************************************************************
+ * @name       :SPI_WaitEnd
+ * @date       :2026-10-17
+ * @function   :Wait until the bytes in the TX FIFO are sent and drop
+ *              what was received meanwhile
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+static void SPI_WaitEnd(void)
+{
+	uint32_t local_timeout = SPI_TIMEOUT;
+	while ((SPI1->SR & SPI_SR_FTLVL) && --local_timeout);
+	local_timeout = SPI_TIMEOUT;
+	while ((SPI1->SR & SPI_SR_BSY) && --local_timeout);
+
+	//Drain the RX FIFO and clear OVR flag
+	while (SPI1->SR & SPI_SR_FRLVL) (void)*(volatile uint8_t*)&SPI1->DR;
+	(void)SPI1->SR;
+}
+
+/*******************************************************************
+ * @name       :SPI_Start
+ * @date       :2026-10-17
+ * @function   :Start the DMA transfer of the head of the queue
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+static void SPI_Start(void)
+{
+	SPI_Transfer *transfer = SPI_Head;
+
+	SPI_Running = 1;
+	SPI_Select(transfer->device, transfer->dc);
+
+	DMA2->LIFCR = DMA_LIFCR_CTCIF3 | DMA_LIFCR_CHTIF3 | DMA_LIFCR_CTEIF3 | DMA_LIFCR_CDMEIF3 | DMA_LIFCR_CFEIF3;
+	SPI_DMA_STREAM->M0AR = (uint32_t)transfer->data;
+	SPI_DMA_STREAM->NDTR = transfer->length;
+
+	SPI1->CR2 |= SPI_CR2_TXDMAEN;
+	SPI_DMA_STREAM->CR |= DMA_SxCR_EN;
+}
+
+/*******************************************************************
+ * @name       :SPI_Write
+ * @date       :2026-10-17
+ * @function   :Send bytes and wait for the end of the transfer. Bytes
+ *              are queued in the TX FIFO as soon as there is room,
+ *              queued DMA transfers are sent first. Not to be called
+ *              from a transfer callback
+ * @parameters :device, dc (SPI_COMMAND or SPI_DATA), data, length
+ * @retvalue   :None
+ *******************************************************************/
+void SPI_Write(SPI_Device *device, uint8_t dc, const uint8_t *data, uint16_t length)
+{
+	//Wait until the bus is free and take it
+	for (;;)
+	{
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		uint8_t taken = !SPI_Running && !SPI_Head && !SPI_Locked;
+		if (taken) SPI_Locked = 1;
+		__set_PRIMASK(primask);
+		if (taken) break;
+	}
+
+	SPI_Select(device, dc);
+	for (uint16_t n = 0; n < length; n++)
+	{
+		while (!(SPI1->SR & SPI_SR_TXE));
+		*(volatile uint8_t*)&SPI1->DR = data[n];
+	}
+	SPI_WaitEnd();
+	SPI_Deselect();
+
+	//Start what was submitted meanwhile
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	SPI_Locked = 0;
+	if (!SPI_Running && SPI_Head) SPI_Start();
+	__set_PRIMASK(primask);
+}
+
+/*******************************************************************
+ * @name       :SPI_Submit
+ * @date       :2026-10-17
+ * @function   :Queue a DMA transfer and the ones linked to it by
+ *              next, started right away if the bus is free. A chain
+ *              is queued at once, nothing submitted from an interrupt
+ *              comes in between. Consecutive transfers to the same
+ *              device keep its CS asserted. The data must stay valid
+ *              until the callback, lengths must not be 0
+ * @parameters :transfer
+ * @retvalue   :None
+ *******************************************************************/
+void SPI_Submit(SPI_Transfer *transfer)
+{
+	SPI_Transfer *last = transfer;
+	while (last->next) last = last->next;
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (SPI_Head) SPI_Tail->next = transfer;
+	else SPI_Head = transfer;
+	SPI_Tail = last;
+	if (!SPI_Running && !SPI_Locked) SPI_Start();
+	__set_PRIMASK(primask);
+}
+
+/*******************************************************************
+ * @name       :SPI_IsBusy
+ * @date       :2026-10-17
+ * @function   :Check if transfers are queued or in progress
+ * @parameters :None
+ * @retvalue   :1 if busy, 0 otherwise
+ *******************************************************************/
+uint8_t SPI_IsBusy(void)
+{
+	return SPI_Running || SPI_Head || SPI_Locked;
+}
+
+/*******************************************************************
+ * @name       :DMA2_Stream3_IRQHandler
+ * @date       :2026-10-17
+ * @function   :End of a transfer: call its callback and start the
+ *              next one
+ * @parameters :None
+ * @retvalue   :None
+ *******************************************************************/
+void DMA2_Stream3_IRQHandler(void)
+{
+	uint8_t error = (DMA2->LISR & DMA_LISR_TEIF3) ? 1 : 0;
+	DMA2->LIFCR = DMA_LIFCR_CTCIF3 | DMA_LIFCR_CHTIF3 | DMA_LIFCR_CTEIF3 | DMA_LIFCR_CDMEIF3 | DMA_LIFCR_CFEIF3;
+
+	//The last bytes are still in the SPI FIFO, wait for them before releasing CS
+	SPI_WaitEnd();
+	SPI1->CR2 &= ~SPI_CR2_TXDMAEN;
+
+	SPI_Transfer *transfer = SPI_Head;
+	SPI_Head = transfer->next;
+	transfer->next = 0;
+	SPI_Running = 0;
+
+	//Keep CS asserted if the device sends again right after
+	if (!SPI_Head || SPI_Head->device != transfer->device) SPI_Deselect();
+
+	//The callback can submit the next transfer
+	if (transfer->callback) transfer->callback(error);
+
+	if (!SPI_Running && SPI_Head && !SPI_Locked) SPI_Start();
+}
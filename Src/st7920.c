@@ -1,90 +1,76 @@
+#include <string.h>
+
 #include "st7920.h"
 #include "tim.h"
+#include "spi.h"
+#include "gpio.h"
+#include "format.h"
 
-/*******************************************************************
- * @name       :ST7920_SpiInit
- * @date       :2024-01-03
- * @function   :SPI Initialization
- * @parameters :None
- * @retvalue   :None
-********************************************************************/ 
-static void ST7920_SpiInit(void)
-{
-	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN; // enable clock for GPIOA
-	RCC->AHB1ENR |= RCC_AHB1ENR_GPIOCEN; // enable clock for GPIOC
-
-	// Initialization of pin PA0-DC
-	GPIOA->MODER |= GPIO_MODER_MODER0_0;
-	GPIOA->MODER &= ~GPIO_MODER_MODER0_1;
+// Buffer for display data
+static uint8_t ST7920_Buffer[(ST7920_WIDTH * ST7920_HEIGHT) / ST7920_DATA_SIZE] __attribute__((aligned(4)));
 
-	// Initialization of pin PC0-CS
-	GPIOC->MODER |= GPIO_MODER_MODER0_0;
-	GPIOC->MODER &= ~GPIO_MODER_MODER0_1;
+// Copy of the GDRAM, used to skip unchanged words during a flush
+static uint8_t ST7920_Shadow[(ST7920_WIDTH * ST7920_HEIGHT) / ST7920_DATA_SIZE] __attribute__((aligned(4)));
+static uint8_t ST7920_ForceFlush = 1; // GDRAM content unknown after reset
 
-	// Initialization of pin PC1-RST
-	GPIOC->MODER |= GPIO_MODER_MODER1_0;
-	GPIOC->MODER &= ~GPIO_MODER_MODER1_1;
+// 16-pixel words modified since the last flush, [start, end) for each row
+static uint8_t ST7920_DirtyStart[ST7920_HEIGHT];
+static uint8_t ST7920_DirtyEnd[ST7920_HEIGHT];
 
-	// Initialization of pin PA5-SCK
-	GPIOA->MODER |= GPIO_MODER_MODER5_1;
-	GPIOA->MODER &= ~GPIO_MODER_MODER5_0;
+// Text layer shown by the CGROM (half-width characters) and copy of the DDRAM
+static char ST7920_Text[ST7920_TEXT_ROWS][ST7920_TEXT_COLUMNS];
+static char ST7920_TextShadow[ST7920_TEXT_ROWS][ST7920_TEXT_COLUMNS];
+static const uint8_t ST7920_TextLine[ST7920_TEXT_ROWS] = { ST7920_CMD_LINE0, ST7920_CMD_LINE1, ST7920_CMD_LINE2, ST7920_CMD_LINE3 };
 
-	// Initialization of pin PA7-MOSI
-	GPIOA->MODER |= GPIO_MODER_MODER7_1;
-	GPIOA->MODER &= ~GPIO_MODER_MODER7_0;
+// Instruction set selected on the controller (basic, extended or extended with graphics)
+static uint8_t ST7920_InstructionSet = ST7920_CMD_BASIC;
 
-	GPIOA->AFR[0] |= ST7920_SPI1_AF << GPIO_AFRL_AFRL5_Pos;
-	GPIOA->AFR[0] |= ST7920_SPI1_AF << GPIO_AFRL_AFRL7_Pos;
+// Serial stream of a flush, 3 bytes per buffer byte: address and data
+// sync bytes plus one nibble per byte, 38 bytes for a full GDRAM row and
+// 39 for a full text row, plus the instruction set changes
+static uint8_t ST7920_Stream[ST7920_HEIGHT * (6 + 2 * (ST7920_WIDTH / ST7920_DATA_SIZE))
+                           + ST7920_TEXT_ROWS * (6 + 2 * ST7920_TEXT_COLUMNS) + 2 * 3];
 
-	//Enable clock access to SPI1 module
-	RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
-
-	//Set MSB first
-	SPI1->CR1 &= ~SPI_CR1_LSBFIRST;
-
-	//Set mode to MASTER
-	SPI1->CR1 |= SPI_CR1_MSTR;
-
-	//Select software slave management by setting SSM=1 and SSI=1
-	SPI1->CR1 |= SPI_CR1_SSM;
-	SPI1->CR1 |= SPI_CR1_SSI;
+// Position of the text being printed in the text layer
+typedef struct
+{
+	uint8_t row;
+	uint8_t column;
+} ST7920_TextCursorCell;
 
-	//Set SPI mode to be MODE1 (CPHA0 CPOL0)
-	SPI1->CR1 |= SPI_CR1_CPHA;
-	SPI1->CR1 &= ~SPI_CR1_CPOL;
+// DMA flush state
+static volatile uint8_t ST7920_DmaBusy = 0;
+static ST7920_FlushCallback ST7920_DmaCallback = 0;
 
-	//Set the frequency of SPI to 500kHz
-	SPI1->CR1 |= SPI_CR1_BR_2;
+// ST7920 on the SPI bus: mode 1, CS active high, no DC pin
+static SPI_Device ST7920_Spi = { SPI_MODE1, ST7920_SPI_FREQUENCY, ST7920_CS_PORT, ST7920_CS_PIN, 1, 0, 0, 0 };
 
-	//Enable SPI module
-	SPI1->CR1 |= SPI_CR1_SPE;
-}                                                  
+// Transfer of the flush stream
+static void ST7920_DmaStreamSent(uint8_t error);
+static SPI_Transfer ST7920_Transfer = { &ST7920_Spi, ST7920_Stream, 0, SPI_DATA, ST7920_DmaStreamSent, 0 };
 
-/*******************************************************************
- * @name       :ST7920_SpiTransmit
- * @date       :2024-05-26
- * @function   :Send with spi
- * @parameters :data
- * @retvalue   :None
-********************************************************************/
-static void ST7920_SpiTransmit(uint8_t msg)
+// Serial frames of a byte: high nibble, then low nibble, each in the upper 4 bits
+static const uint8_t ST7920_Nibbles[256][2] =
 {
-	//Wait until TXE is set
-	while(!(SPI1->SR & (SPI_SR_TXE)));
-
-	//Write the data to the data register
-	*(volatile uint8_t*) & SPI1->DR = msg;
-			
-	//Wait until TXE is set
-	while(!(SPI1->SR & (SPI_SR_TXE)));
-
-	//Wait for BUSY flag to reset
-	while((SPI1->SR & (SPI_SR_BSY)));
-
-	//Clear OVR flag
-	(void)SPI1->DR;
-	(void)SPI1->SR;
-}
+	{ 0x00, 0x00 }, { 0x00, 0x10 }, { 0x00, 0x20 }, { 0x00, 0x30 }, { 0x00, 0x40 }, { 0x00, 0x50 }, { 0x00, 0x60 }, { 0x00, 0x70 }, { 0x00, 0x80 }, { 0x00, 0x90 }, { 0x00, 0xA0 }, { 0x00, 0xB0 }, { 0x00, 0xC0 }, { 0x00, 0xD0 }, { 0x00, 0xE0 }, { 0x00, 0xF0 },
+	{ 0x10, 0x00 }, { 0x10, 0x10 }, { 0x10, 0x20 }, { 0x10, 0x30 }, { 0x10, 0x40 }, { 0x10, 0x50 }, { 0x10, 0x60 }, { 0x10, 0x70 }, { 0x10, 0x80 }, { 0x10, 0x90 }, { 0x10, 0xA0 }, { 0x10, 0xB0 }, { 0x10, 0xC0 }, { 0x10, 0xD0 }, { 0x10, 0xE0 }, { 0x10, 0xF0 },
+	{ 0x20, 0x00 }, { 0x20, 0x10 }, { 0x20, 0x20 }, { 0x20, 0x30 }, { 0x20, 0x40 }, { 0x20, 0x50 }, { 0x20, 0x60 }, { 0x20, 0x70 }, { 0x20, 0x80 }, { 0x20, 0x90 }, { 0x20, 0xA0 }, { 0x20, 0xB0 }, { 0x20, 0xC0 }, { 0x20, 0xD0 }, { 0x20, 0xE0 }, { 0x20, 0xF0 },
+	{ 0x30, 0x00 }, { 0x30, 0x10 }, { 0x30, 0x20 }, { 0x30, 0x30 }, { 0x30, 0x40 }, { 0x30, 0x50 }, { 0x30, 0x60 }, { 0x30, 0x70 }, { 0x30, 0x80 }, { 0x30, 0x90 }, { 0x30, 0xA0 }, { 0x30, 0xB0 }, { 0x30, 0xC0 }, { 0x30, 0xD0 }, { 0x30, 0xE0 }, { 0x30, 0xF0 },
+	{ 0x40, 0x00 }, { 0x40, 0x10 }, { 0x40, 0x20 }, { 0x40, 0x30 }, { 0x40, 0x40 }, { 0x40, 0x50 }, { 0x40, 0x60 }, { 0x40, 0x70 }, { 0x40, 0x80 }, { 0x40, 0x90 }, { 0x40, 0xA0 }, { 0x40, 0xB0 }, { 0x40, 0xC0 }, { 0x40, 0xD0 }, { 0x40, 0xE0 }, { 0x40, 0xF0 },
+	{ 0x50, 0x00 }, { 0x50, 0x10 }, { 0x50, 0x20 }, { 0x50, 0x30 }, { 0x50, 0x40 }, { 0x50, 0x50 }, { 0x50, 0x60 }, { 0x50, 0x70 }, { 0x50, 0x80 }, { 0x50, 0x90 }, { 0x50, 0xA0 }, { 0x50, 0xB0 }, { 0x50, 0xC0 }, { 0x50, 0xD0 }, { 0x50, 0xE0 }, { 0x50, 0xF0 },
+	{ 0x60, 0x00 }, { 0x60, 0x10 }, { 0x60, 0x20 }, { 0x60, 0x30 }, { 0x60, 0x40 }, { 0x60, 0x50 }, { 0x60, 0x60 }, { 0x60, 0x70 }, { 0x60, 0x80 }, { 0x60, 0x90 }, { 0x60, 0xA0 }, { 0x60, 0xB0 }, { 0x60, 0xC0 }, { 0x60, 0xD0 }, { 0x60, 0xE0 }, { 0x60, 0xF0 },
+	{ 0x70, 0x00 }, { 0x70, 0x10 }, { 0x70, 0x20 }, { 0x70, 0x30 }, { 0x70, 0x40 }, { 0x70, 0x50 }, { 0x70, 0x60 }, { 0x70, 0x70 }, { 0x70, 0x80 }, { 0x70, 0x90 }, { 0x70, 0xA0 }, { 0x70, 0xB0 }, { 0x70, 0xC0 }, { 0x70, 0xD0 }, { 0x70, 0xE0 }, { 0x70, 0xF0 },
+	{ 0x80, 0x00 }, { 0x80, 0x10 }, { 0x80, 0x20 }, { 0x80, 0x30 }, { 0x80, 0x40 }, { 0x80, 0x50 }, { 0x80, 0x60 }, { 0x80, 0x70 }, { 0x80, 0x80 }, { 0x80, 0x90 }, { 0x80, 0xA0 }, { 0x80, 0xB0 }, { 0x80, 0xC0 }, { 0x80, 0xD0 }, { 0x80, 0xE0 }, { 0x80, 0xF0 },
+	{ 0x90, 0x00 }, { 0x90, 0x10 }, { 0x90, 0x20 }, { 0x90, 0x30 }, { 0x90, 0x40 }, { 0x90, 0x50 }, { 0x90, 0x60 }, { 0x90, 0x70 }, { 0x90, 0x80 }, { 0x90, 0x90 }, { 0x90, 0xA0 }, { 0x90, 0xB0 }, { 0x90, 0xC0 }, { 0x90, 0xD0 }, { 0x90, 0xE0 }, { 0x90, 0xF0 },
+	{ 0xA0, 0x00 }, { 0xA0, 0x10 }, { 0xA0, 0x20 }, { 0xA0, 0x30 }, { 0xA0, 0x40 }, { 0xA0, 0x50 }, { 0xA0, 0x60 }, { 0xA0, 0x70 }, { 0xA0, 0x80 }, { 0xA0, 0x90 }, { 0xA0, 0xA0 }, { 0xA0, 0xB0 }, { 0xA0, 0xC0 }, { 0xA0, 0xD0 }, { 0xA0, 0xE0 }, { 0xA0, 0xF0 },
+	{ 0xB0, 0x00 }, { 0xB0, 0x10 }, { 0xB0, 0x20 }, { 0xB0, 0x30 }, { 0xB0, 0x40 }, { 0xB0, 0x50 }, { 0xB0, 0x60 }, { 0xB0, 0x70 }, { 0xB0, 0x80 }, { 0xB0, 0x90 }, { 0xB0, 0xA0 }, { 0xB0, 0xB0 }, { 0xB0, 0xC0 }, { 0xB0, 0xD0 }, { 0xB0, 0xE0 }, { 0xB0, 0xF0 },
+	{ 0xC0, 0x00 }, { 0xC0, 0x10 }, { 0xC0, 0x20 }, { 0xC0, 0x30 }, { 0xC0, 0x40 }, { 0xC0, 0x50 }, { 0xC0, 0x60 }, { 0xC0, 0x70 }, { 0xC0, 0x80 }, { 0xC0, 0x90 }, { 0xC0, 0xA0 }, { 0xC0, 0xB0 }, { 0xC0, 0xC0 }, { 0xC0, 0xD0 }, { 0xC0, 0xE0 }, { 0xC0, 0xF0 },
+	{ 0xD0, 0x00 }, { 0xD0, 0x10 }, { 0xD0, 0x20 }, { 0xD0, 0x30 }, { 0xD0, 0x40 }, { 0xD0, 0x50 }, { 0xD0, 0x60 }, { 0xD0, 0x70 }, { 0xD0, 0x80 }, { 0xD0, 0x90 }, { 0xD0, 0xA0 }, { 0xD0, 0xB0 }, { 0xD0, 0xC0 }, { 0xD0, 0xD0 }, { 0xD0, 0xE0 }, { 0xD0, 0xF0 },
+	{ 0xE0, 0x00 }, { 0xE0, 0x10 }, { 0xE0, 0x20 }, { 0xE0, 0x30 }, { 0xE0, 0x40 }, { 0xE0, 0x50 }, { 0xE0, 0x60 }, { 0xE0, 0x70 }, { 0xE0, 0x80 }, { 0xE0, 0x90 }, { 0xE0, 0xA0 }, { 0xE0, 0xB0 }, { 0xE0, 0xC0 }, { 0xE0, 0xD0 }, { 0xE0, 0xE0 }, { 0xE0, 0xF0 },
+	{ 0xF0, 0x00 }, { 0xF0, 0x10 }, { 0xF0, 0x20 }, { 0xF0, 0x30 }, { 0xF0, 0x40 }, { 0xF0, 0x50 }, { 0xF0, 0x60 }, { 0xF0, 0x70 }, { 0xF0, 0x80 }, { 0xF0, 0x90 }, { 0xF0, 0xA0 }, { 0xF0, 0xB0 }, { 0xF0, 0xC0 }, { 0xF0, 0xD0 }, { 0xF0, 0xE0 }, { 0xF0, 0xF0 }
+};
+
+static uint8_t Graphic_Check = 0;
 
 /*******************************************************************
  * @name       :ST7920_SendCmd
@@ -95,11 +81,8 @@ static void ST7920_SpiTransmit(uint8_t msg)
 ********************************************************************/
 static void ST7920_SendCmd(uint8_t cmd)
 {
-	ST7920_CS_HIGH;  
-	ST7920_SpiTransmit(ST7920_CMD);
-	ST7920_SpiTransmit(cmd & ST7920_FOUR_STRONG_BITS);
-	ST7920_SpiTransmit((cmd<<4) & ST7920_FOUR_STRONG_BITS);
-	ST7920_CS_LOW;  
+	uint8_t frames[3] = { ST7920_CMD, ST7920_Nibbles[cmd][0], ST7920_Nibbles[cmd][1] };
+	SPI_Write(&ST7920_Spi, SPI_DATA, frames, sizeof(frames));
 }
 
 /*******************************************************************
@@ -111,43 +94,74 @@ static void ST7920_SendCmd(uint8_t cmd)
 ********************************************************************/
 static void ST7920_SendData (uint8_t data)
 {
-	ST7920_CS_HIGH;  
-	ST7920_SpiTransmit(ST7920_DATA);
-	ST7920_SpiTransmit(data & ST7920_FOUR_STRONG_BITS);
-	ST7920_SpiTransmit((data<<4) & ST7920_FOUR_STRONG_BITS);
-	ST7920_CS_LOW;  
+	uint8_t frames[3] = { ST7920_DATA, ST7920_Nibbles[data][0], ST7920_Nibbles[data][1] };
+	SPI_Write(&ST7920_Spi, SPI_DATA, frames, sizeof(frames));
+}
+
+/*******************************************************************
+ * @name       :ST7920_TextCharacter
+ * @date       :2026-10-17
+ * @function   :Write one formatted character in the text layer,
+ *              characters past the end of the line are dropped
+ * @parameters :context (text cell), c
+ * @retvalue   :None
+********************************************************************/ 
+static void ST7920_TextCharacter(void *context, char c)
+{
+	ST7920_TextCursorCell *cell = context;
+	if (cell->column >= ST7920_TEXT_COLUMNS) return;
+
+	ST7920_Text[cell->row][cell->column++] = c;
+}
+
+/*******************************************************************
+ * @name       :ST7920_TextPrint
+ * @date       :2026-10-17
+ * @function   :Write formatted text in the text layer, drawn by the
+ *              CGROM (8x16 pixel cells, 16 columns x 4 rows). Only the
+ *              changed characters are sent by the next flush
+ * @parameters :row, column, format, ...
+ * @retvalue   :None
+********************************************************************/ 
+void ST7920_TextPrint(uint8_t row, uint8_t column, const char *format, ...)
+{
+	if (row >= ST7920_TEXT_ROWS) return;
+
+	ST7920_TextCursorCell cell = { row, column };
+
+	va_list args;
+	va_start(args, format);
+	FORMAT_Print(ST7920_TextCharacter, &cell, format, args);
+	va_end(args);
+}
+
+/*******************************************************************
+ * @name       :ST7920_TextClear
+ * @date       :2026-10-17
+ * @function   :Fill the text layer with spaces
+ * @parameters :None
+ * @retvalue   :None
+********************************************************************/ 
+void ST7920_TextClear(void)
+{
+	memset(ST7920_Text, ' ', sizeof(ST7920_Text));
 }
 
 /*******************************************************************
  * @name       :ST7920_SendString
  * @date       :2024-05-26
- * @function   :Send string
- * @parameters :row, col, string
+ * @function   :Write a string in the text layer, sent by the next flush
+ * @parameters :row, col (DDRAM address, one per 16 pixels: two
+ *              characters), string
  * @retvalue   :None
 ********************************************************************/ 
 void ST7920_SendString(int row, int col, char* string)
 {
-	switch (row)
-	{
-		case 0:
-			col |= ST7920_CMD_LINE0;
-			break;
-		case 1:
-			col |= ST7920_CMD_LINE1;
-			break;
-		case 2:
-			col |= ST7920_CMD_LINE2;
-			break;
-		case 3:
-			col |= ST7920_CMD_LINE3;
-			break;
-		default:
-			col |= ST7920_CMD_LINE0;
-			break;
-	}
+	if (row < 0 || row >= ST7920_TEXT_ROWS) row = 0;
+	if (col < 0 || col >= ST7920_WORDS) return;
 
-	ST7920_SendCmd(col);
-	while (*string) ST7920_SendData(*string++);
+	ST7920_TextCursorCell cell = { row, col * 2 };
+	while (*string) ST7920_TextCharacter(&cell, *string++);
 }
 
 /*******************************************************************
@@ -167,57 +181,343 @@ void ST7920_GraphicMode(int enable)
 		TIM_Wait(1);
 		ST7920_SendCmd(ST7920_CMD_GFXMODE);
 		TIM_Wait(1);
+		ST7920_InstructionSet = ST7920_CMD_GFXMODE;
 		Graphic_Check = 1;
 	}
 	else 
 	{
 		ST7920_SendCmd(ST7920_CMD_BASIC);
 		TIM_Wait(1);
+		ST7920_InstructionSet = ST7920_CMD_BASIC;
 		Graphic_Check = 0;
 	}
 }
 
+/*******************************************************************
+ * @name       :ST7920_MarkDirty
+ * @date       :2026-10-17
+ * @function   :Mark the words of a row holding pixels first..last
+ *              as modified since last flush
+ * @parameters :y, first, last (pixel columns, inclusive)
+ * @retvalue   :None
+********************************************************************/
+static inline void ST7920_MarkDirty(uint8_t y, uint8_t first, uint8_t last)
+{
+	first /= 16;
+	last /= 16;
+	if (first < ST7920_DirtyStart[y]) ST7920_DirtyStart[y] = first;
+	if (last >= ST7920_DirtyEnd[y]) ST7920_DirtyEnd[y] = last + 1;
+}
+
+/*******************************************************************
+ * @name       :ST7920_MarkAllDirty
+ * @date       :2026-10-17
+ * @function   :Mark the whole buffer as modified since last flush
+ * @parameters :None
+ * @retvalue   :None
+********************************************************************/
+static void ST7920_MarkAllDirty(void)
+{
+	for (int y = 0; y < ST7920_HEIGHT; y++)
+	{
+		ST7920_DirtyStart[y] = 0;
+		ST7920_DirtyEnd[y] = ST7920_WORDS;
+	}
+}
+
+/*******************************************************************
+ * @name       :ST7920_EncodeByte
+ * @date       :2026-10-17
+ * @function   :Append a byte to the stream as its two nibble frames
+ * @parameters :stream, value
+ * @retvalue   :Position after the written frames
+********************************************************************/
+static inline uint8_t *ST7920_EncodeByte(uint8_t *stream, uint8_t value)
+{
+	*stream++ = ST7920_Nibbles[value][0];
+	*stream++ = ST7920_Nibbles[value][1];
+	return stream;
+}
+
+/*******************************************************************
+ * @name       :ST7920_EncodeInstructionSet
+ * @date       :2026-10-17
+ * @function   :Append a function set command if the controller is
+ *              not already using this instruction set
+ * @parameters :stream, instructionSet (ST7920_CMD_BASIC, _EXTEND or
+ *              _GFXMODE)
+ * @retvalue   :Position after the written frames
+********************************************************************/
+static uint8_t *ST7920_EncodeInstructionSet(uint8_t *stream, uint8_t instructionSet)
+{
+	if (ST7920_InstructionSet == instructionSet) return stream;
+
+	*stream++ = ST7920_CMD;
+	stream = ST7920_EncodeByte(stream, instructionSet);
+	ST7920_InstructionSet = instructionSet;
+	return stream;
+}
+
+/*******************************************************************
+ * @name       :ST7920_EncodeText
+ * @date       :2026-10-17
+ * @function   :Encode the changed characters of each text row. DDRAM
+ *              is addressed by 16-bit words of two characters, so a
+ *              range starts on an even column and ends on an odd one
+ * @parameters :stream
+ * @retvalue   :Position after the written frames
+********************************************************************/
+static uint8_t *ST7920_EncodeText(uint8_t *stream)
+{
+	for (uint8_t row = 0; row < ST7920_TEXT_ROWS; row++)
+	{
+		uint8_t first = 0;
+		uint8_t end = ST7920_TEXT_COLUMNS;
+
+		if (!ST7920_ForceFlush)
+		{
+			while (first < end && ST7920_Text[row][first] == ST7920_TextShadow[row][first]) first++;
+			while (first < end && ST7920_Text[row][end - 1] == ST7920_TextShadow[row][end - 1]) end--;
+		}
+		if (first >= end) continue;
+
+		first &= ~1;
+		end = (end + 1) & ~1;
+
+		//DDRAM is addressed with the basic instruction set
+		stream = ST7920_EncodeInstructionSet(stream, ST7920_CMD_BASIC);
+
+		*stream++ = ST7920_CMD;
+		stream = ST7920_EncodeByte(stream, ST7920_TextLine[row] | (first / 2));
+
+		*stream++ = ST7920_DATA;
+		for (uint8_t column = first; column < end; column++) stream = ST7920_EncodeByte(stream, ST7920_Text[row][column]);
+
+		memcpy(&ST7920_TextShadow[row][first], &ST7920_Text[row][first], end - first);
+	}
+
+	return stream;
+}
+
+/*******************************************************************
+ * @name       :ST7920_Encode
+ * @date       :2026-10-17
+ * @function   :Encode the modified words of each row into the serial
+ *              stream: the row address once, then its bytes, while the
+ *              horizontal address increments by itself. Unchanged
+ *              words at both ends of a dirty range are skipped.
+ *              Changed text comes first
+ * @parameters :None
+ * @retvalue   :Length of the stream in bytes
+********************************************************************/
+static uint16_t ST7920_Encode(void)
+{
+	uint8_t *stream = ST7920_EncodeText(ST7920_Stream);
+
+	for (uint8_t y = 0; y < ST7920_HEIGHT; y++)
+	{
+		uint8_t first = ST7920_DirtyStart[y];
+		uint8_t end = ST7920_DirtyEnd[y];
+		ST7920_DirtyStart[y] = ST7920_WORDS;
+		ST7920_DirtyEnd[y] = 0;
+
+		const uint16_t *row = (const uint16_t *)&ST7920_Buffer[y * (ST7920_WIDTH / ST7920_DATA_SIZE)];
+		uint16_t *shadow = (uint16_t *)&ST7920_Shadow[y * (ST7920_WIDTH / ST7920_DATA_SIZE)];
+
+		if (!ST7920_ForceFlush)
+		{
+			while (first < end && row[first] == shadow[first]) first++;
+			while (first < end && row[end - 1] == shadow[end - 1]) end--;
+		}
+		if (first >= end) continue;
+
+		//GDRAM is addressed with the extended instruction set
+		stream = ST7920_EncodeInstructionSet(stream, Graphic_Check ? ST7920_CMD_GFXMODE : ST7920_CMD_EXTEND);
+
+		//The lower half of the screen follows the upper half in GDRAM
+		uint8_t verticalCoord = (y < 32) ? y : y - 32;
+		uint8_t horizontalCmd = (y < 32) ? ST7920_CMD_LINE0 : ST7920_CMD_LINE2;
+
+		*stream++ = ST7920_CMD;
+		stream = ST7920_EncodeByte(stream, ST7920_CMD_LINE0 | verticalCoord);
+		stream = ST7920_EncodeByte(stream, horizontalCmd | first);
+
+		*stream++ = ST7920_DATA;
+		const uint8_t *bytes = (const uint8_t *)row;
+		for (uint8_t x = 2 * first; x < 2 * end; x++) stream = ST7920_EncodeByte(stream, bytes[x]);
+
+		memcpy(&shadow[first], &row[first], 2 * (end - first));
+	}
+
+	//Leave the controller with graphics shown or hidden as selected
+	if (Graphic_Check) stream = ST7920_EncodeInstructionSet(stream, ST7920_CMD_GFXMODE);
+
+	ST7920_ForceFlush = 0;
+	return stream - ST7920_Stream;
+}
+
+/*******************************************************************
+ * @name       :ST7920_SendBufferDMA
+ * @date       :2026-10-17
+ * @function   :Encode the modified parts of the buffer and send the
+ *              stream with DMA in one transfer. The buffer can be
+ *              drawn again as soon as this returns
+ * @parameters :callback (called at the end of the flush, can be 0)
+ * @retvalue   :None
+********************************************************************/ 
+void ST7920_SendBufferDMA(ST7920_FlushCallback callback)
+{
+	//Wait for the previous flush, its stream is still being sent
+	while (ST7920_DmaBusy);
+
+	uint16_t length = ST7920_Encode();
+	if (!length)
+	{
+		if (callback) callback();
+		return;
+	}
+
+	ST7920_DmaCallback = callback;
+	ST7920_DmaBusy = 1;
+
+	ST7920_Transfer.length = length;
+	SPI_Submit(&ST7920_Transfer);
+}
+
 /*******************************************************************
  * @name       :ST7920_SendBuffer
  * @date       :2024-06-01
- * @function   :Select graphic mode
- * @parameters :enable (1 or 0)
+ * @function   :Send the modified parts of the buffer and wait for
+ *              the end of the transfer
+ * @parameters :None
  * @retvalue   :None
 ********************************************************************/ 
 void ST7920_SendBuffer(void)
 {
-	for (uint8_t y = 0; y < 64; y++)
+	ST7920_SendBufferDMA(0);
+	while (ST7920_DmaBusy);
+}
+
+/*******************************************************************
+ * @name       :ST7920_IsBusy
+ * @date       :2026-10-17
+ * @function   :Check if a DMA flush is in progress
+ * @parameters :None
+ * @retvalue   :1 if busy, 0 otherwise
+********************************************************************/ 
+uint8_t ST7920_IsBusy(void)
+{
+	return ST7920_DmaBusy;
+}
+
+/*******************************************************************
+ * @name       :ST7920_GetBuffer
+ * @date       :2026-10-17
+ * @function   :Framebuffer being drawn, for a capture. Rows of
+ *              ST7920_WIDTH pixels, MSB on the left
+ * @parameters :None
+ * @retvalue   :Framebuffer
+********************************************************************/ 
+const uint8_t *ST7920_GetBuffer(void)
+{
+	return ST7920_Buffer;
+}
+
+/*******************************************************************
+ * @name       :ST7920_DmaStreamSent
+ * @date       :2026-10-17
+ * @function   :End of the stream transfer
+ * @parameters :error (DMA transfer error)
+ * @retvalue   :None
+********************************************************************/ 
+static void ST7920_DmaStreamSent(uint8_t error)
+{
+	if (error)
 	{
-		uint8_t verticalCoord = (y < 32) ? y : y - 32;
-		uint8_t horizontalCmd = (y < 32) ? ST7920_CMD_LINE0 : ST7920_CMD_LINE2;
+		//The GDRAM content and the instruction set are unknown, resend everything next time
+		ST7920_MarkAllDirty();
+		ST7920_InstructionSet = 0;
+		ST7920_ForceFlush = 1;
+	}
 
-		for (uint8_t x = 0; x < 8; x++)
-		{
-			ST7920_SendCmd(ST7920_CMD_LINE0 | verticalCoord);
-			ST7920_SendCmd(horizontalCmd | x);
-			ST7920_SendData(ST7920_Buffer[2 * x + 16 * y]);
-			ST7920_SendData(ST7920_Buffer[2 * x + 1 + 16 * y]);
-		}
+	ST7920_DmaBusy = 0;
+	if (ST7920_DmaCallback) ST7920_DmaCallback();
+}
+
+/*******************************************************************
+ * @name       : ST7920_PutPixel
+ * @date       : 2026-10-17
+ * @function   : Set pixel in buffer without range check (rasterizer
+ *               kernel, pixels are already inside the screen)
+ * @parameters : color, x, y
+ * @retvalue   : None
+********************************************************************/
+static void ST7920_PutPixel(uint8_t color, int16_t x, int16_t y) 
+{
+	uint16_t index = y * (ST7920_WIDTH / ST7920_DATA_SIZE) + (x / ST7920_DATA_SIZE);
+	uint8_t bitOffset = 0x80u >> (x % ST7920_DATA_SIZE);
+
+	if (color) ST7920_Buffer[index] |= bitOffset;
+	else ST7920_Buffer[index] &= ~bitOffset;
+
+	ST7920_MarkDirty(y, x, x);
+}
+/*******************************************************************
+ * @name       :ST7920_FillRect
+ * @date       :2026-10-17
+ * @function   :Fill an area already clipped to the screen (rasterizer
+ *              kernel), partial bytes at both ends of each row are
+ *              masked, the rest is memset
+ * @parameters :color, x, y, w, h
+ * @retvalue   :None
+********************************************************************/ 
+static void ST7920_FillRect(uint8_t color, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	const uint8_t rowSize = ST7920_WIDTH / ST7920_DATA_SIZE;
+	uint8_t fill = color ? 0xFF : 0x00;
+	uint8_t firstByte = x / ST7920_DATA_SIZE;
+	uint8_t lastByte = (x + w - 1) / ST7920_DATA_SIZE;
+	uint8_t firstMask = 0xFF >> (x % ST7920_DATA_SIZE);
+	uint8_t lastMask = 0xFF << (7 - (x + w - 1) % ST7920_DATA_SIZE);
+
+	for (int16_t row = y; row < y + h; row++) ST7920_MarkDirty(row, x, x + w - 1);
+
+	//Full rows are one block
+	if (w == ST7920_WIDTH)
+	{
+		memset(&ST7920_Buffer[y * rowSize], fill, h * rowSize);
+		return;
+	}
+
+	if (firstByte == lastByte) firstMask &= lastMask;
+
+	for (int16_t row = y; row < y + h; row++)
+	{
+		uint8_t *line = &ST7920_Buffer[row * rowSize];
+
+		if (color) line[firstByte] |= firstMask;
+		else line[firstByte] &= ~firstMask;
+		if (firstByte == lastByte) continue;
+
+		memset(&line[firstByte + 1], fill, lastByte - firstByte - 1);
+		if (color) line[lastByte] |= lastMask;
+		else line[lastByte] &= ~lastMask;
 	}
 }
+// Kernels of the ST7920 row layout for the shared rasterizer. Glyphs are
+// vertical bytes across horizontal ones, they are drawn pixel by pixel
+static const GFX_Display ST7920_Display = { ST7920_WIDTH, ST7920_HEIGHT, ST7920_PutPixel, ST7920_FillRect, 0 };
 
 /*******************************************************************
  * @name       : ST7920_SetPixel
  * @date       : 2024-06-01
- * @function   : Draw a character at specified position
- * @parameters : color, x, y, font, letterNumberAscii
+ * @function   : Set pixel in buffer
+ * @parameters : color, x, y
  * @retvalue   : None
 ********************************************************************/
 void ST7920_SetPixel(uint8_t color, int16_t x, int16_t y) 
 {
-	if (x >= 0 && x < ST7920_WIDTH && y >= 0 && y < ST7920_HEIGHT) 
-	{
-		uint16_t index = y * (ST7920_WIDTH / ST7920_DATA_SIZE) + (x / ST7920_DATA_SIZE);
-		uint8_t bitOffset = 0x80u >> (x % ST7920_DATA_SIZE);
-
-		if (color) ST7920_Buffer[index] |= bitOffset;
-		else ST7920_Buffer[index] &= ~bitOffset;
-	}
+	GFX_SetPixel(&ST7920_Display, color, x, y);
 }
 
 /*******************************************************************
@@ -229,27 +529,7 @@ void ST7920_SetPixel(uint8_t color, int16_t x, int16_t y)
 ********************************************************************/
 void ST7920_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font, uint8_t letterNumberAscii) 
 {
-	if (letterNumberAscii < font->asciiBegin || letterNumberAscii > font->asciiEnd) return;
-	
-	uint8_t letterNumber = letterNumberAscii - font->asciiOffset;
-	uint16_t index_letterSize = letterNumber * font->datasize;
-	uint8_t letterSize = font->data[index_letterSize];
-
-	for (int column = 0; column < letterSize; column++) 
-	{
-		for (int byteColumn = 0; byteColumn < font->bytesPerColums; byteColumn++) 
-		{
-			uint16_t index_Buffer = 1 + letterNumber * font->datasize + byteColumn + font->bytesPerColums * column;
-			uint8_t data = font->data[index_Buffer];
-			for (int bit = 0; bit < 8; bit++) 
-			{
-				uint8_t pixel = (data >> bit) & 1;
-				int16_t a = x + column;
-				int16_t b = y + (bit + 8 * byteColumn);
-				if (pixel) ST7920_SetPixel(color, a, b);
-			}
-		}
-	}
+	GFX_DrawCharacter(&ST7920_Display, color, x, y, font, letterNumberAscii);
 }
 
 /*******************************************************************
@@ -261,72 +541,105 @@ void ST7920_DrawCharacter(uint8_t color, int16_t x, int16_t y, const Font *font,
 ********************************************************************/ 
 void ST7920_DrawStr(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format)
 {
-	while (*format && x < ST7920_WIDTH && y < ST7920_HEIGHT) 
-	{
-		uint8_t currentChar = *format;
+	GFX_DrawStr(&ST7920_Display, color, x, y, font, format);
+}
 
-		ST7920_DrawCharacter(color, x, y, font, currentChar);
+/*******************************************************************
+ * @name       : ST7920_MeasureStr
+ * @date       : 2026-10-17
+ * @function   : Width in pixels of a string once drawn
+ * @parameters : font, content
+ * @retvalue   : Width, without the spacing after the last letter
+********************************************************************/ 
+uint16_t ST7920_MeasureStr(const Font *font, const char *content)
+{
+	return GFX_MeasureStr(font, content);
+}
 
-		// Create a space between the letters
-		uint8_t letterNumber = currentChar - font->asciiOffset;
-		uint16_t index_letterSize = letterNumber * font->datasize;
-		uint8_t letterSize = font->data[index_letterSize];
-		x += letterSize + (font->length / 10);
+/*******************************************************************
+ * @name       : ST7920_FontMeasure
+ * @date       : 2026-10-17
+ * @function   : Width in pixels of formatted text once drawn
+ * @parameters : font, format, ...
+ * @retvalue   : Width, without the spacing after the last letter
+********************************************************************/ 
+uint16_t ST7920_FontMeasure(const Font *font, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	uint16_t width = GFX_Measure(font, format, args);
+	va_end(args);
 
-		// Go to next letter
-		format++;
-	}
+	return width;
 }
 
 /*******************************************************************
  * @name       : ST7920_FontPrint
  * @date       : 2024-01-03
- * @function   : Set pixel in buffer
- * @parameters : color, x, y, font, content
+ * @function   : Draw formatted text, streamed straight into the
+ *               buffer without an intermediate string
+ * @parameters : color, x, y, font, format, ...
  * @retvalue   : None
 ********************************************************************/ 
 void ST7920_FontPrint(uint8_t color, int16_t x, int16_t y, const Font *font, const char *format, ...) 
 {
 	va_list args;
 	va_start(args, format);
-	char formatted_string[50]; 
-	vsprintf(formatted_string, format, args);
+	GFX_Print(&ST7920_Display, color, x, y, GFX_ALIGN_LEFT, font, format, args);
 	va_end(args);
+}
+
+/*******************************************************************
+ * @name       : ST7920_FontPrintAligned
+ * @date       : 2026-10-17
+ * @function   : Draw formatted text aligned on x: the text is measured
+ *               first, then drawn from its left edge
+ * @parameters : color, x, y, align (ST7920_ALIGN_LEFT, _CENTER or
+ *               _RIGHT), font, format, ...
+ * @retvalue   : None
+********************************************************************/ 
+void ST7920_FontPrintAligned(uint8_t color, int16_t x, int16_t y, uint8_t align, const Font *font, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	GFX_Print(&ST7920_Display, color, x, y, align, font, format, args);
+	va_end(args);
+}
+
+/*******************************************************************
+ * @name       :ST7920_DrawHLine
+ * @date       :2026-10-17
+ * @function   :Draw a horizontal line (whole bytes inside the run)
+ * @parameters :color, x, y, w
+ * @retvalue   :None
+********************************************************************/ 
+void ST7920_DrawHLine(uint8_t color, int16_t x, int16_t y, int16_t w)
+{
+	GFX_DrawHLine(&ST7920_Display, color, x, y, w);
+}
 
-	ST7920_DrawStr(color, x, y, font, formatted_string); 
+/*******************************************************************
+ * @name       :ST7920_DrawVLine
+ * @date       :2026-10-17
+ * @function   :Draw a vertical line (one masked byte per row)
+ * @parameters :color, x, y, h
+ * @retvalue   :None
+********************************************************************/ 
+void ST7920_DrawVLine(uint8_t color, int16_t x, int16_t y, int16_t h)
+{
+	GFX_DrawVLine(&ST7920_Display, color, x, y, h);
 }
 
 /*******************************************************************
  * @name       :ST7920_DrawLine
  * @date       :2024-01-03
- * @function   :Draw a line
+ * @function   :Draw a line, clipped to the screen before walking it
  * @parameters :color, x0, y0, x1, y1
  * @retvalue   :None
 ********************************************************************/ 
-void ST7920_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) 
+void ST7920_DrawLine(uint8_t color, int16_t x0, int16_t y0, int16_t x1, int16_t y1) 
 {
-	int dx = (x1 >= x0) ? x1 - x0 : x0 - x1;
-	int dy = (y1 >= y0) ? y1 - y0 : y0 - y1;
-	int sx = (x0 < x1) ? 1 : -1;
-	int sy = (y0 < y1) ? 1 : -1;
-	int err = dx - dy;
-
-	while(1)
-	{
-		ST7920_SetPixel(color, x0, y0);
-		if (x0 == x1 && y0 == y1) break;
-		int e2 = err + err;
-		if (e2 > -dy)
-		{
-			err -= dy;
-			x0 += sx;
-		}
-		if (e2 < dx)
-		{
-			err += dx;
-			y0 += sy;
-		}
-	}
+	GFX_DrawLine(&ST7920_Display, color, x0, y0, x1, y1);
 }
 
 /*******************************************************************
@@ -338,18 +651,7 @@ void ST7920_DrawLine(uint8_t color, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t
 ********************************************************************/ 
 void ST7920_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-	//Check input parameters
-	if (x >= ST7920_WIDTH || y >= ST7920_HEIGHT) return;
-
-	//Check width and height
-	if ((x + w) >= ST7920_WIDTH) w = ST7920_WIDTH - x;
-	if ((y + h) >= ST7920_HEIGHT) h = ST7920_HEIGHT - y;
-
-	//Draw 4 lines
-	ST7920_DrawLine(color, x, y, x + w, y);         //Top line
-	ST7920_DrawLine(color, x, y + h, x + w, y + h); //Bottom line
-	ST7920_DrawLine(color, x, y, x, y + h);         //Left line
-	ST7920_DrawLine(color, x + w, y, x + w, y + h); //Right line
+	GFX_DrawRectangle(&ST7920_Display, color, x, y, w, h);
 }
 
 /*******************************************************************
@@ -361,16 +663,7 @@ void ST7920_DrawRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uin
 ********************************************************************/
 void ST7920_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-	//Check input parameters
-	if (x >= ST7920_WIDTH || y >= ST7920_HEIGHT) return;
-
-	//Check width and height
-	if ((x + w) >= ST7920_WIDTH) w = ST7920_WIDTH - x;
-	if ((y + h) >= ST7920_HEIGHT) h = ST7920_HEIGHT - y;
-
-	//Draw lines
-	for (int i = 0; i <= h; i++)
-		ST7920_DrawLine(color, x, y + i, x + w, y + i);
+	GFX_DrawFilledRectangle(&ST7920_Display, color, x, y, w, h);
 }
 
 /*******************************************************************
@@ -380,37 +673,9 @@ void ST7920_DrawFilledRectangle(uint8_t color, uint16_t x, uint16_t y, uint16_t
  * @parameters :color, x0, y0, radius
  * @retvalue   :None
 ********************************************************************/ 
-void ST7920_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius)
+void ST7920_DrawCircle(uint8_t color, int16_t x0, int16_t y0, uint8_t radius)
 {
-	int x = radius;
-	int y = 0;
-	int err = 0;
-
-	ST7920_SetPixel(color, x0, y0 + radius);
-	ST7920_SetPixel(color, x0, y0 - radius);
-	ST7920_SetPixel(color, x0 + radius, y0);
-	ST7920_SetPixel(color, x0 - radius, y0);
-
-	while (x >= y)
-	{
-		ST7920_SetPixel(color, x0 + x, y0 + y);
-		ST7920_SetPixel(color, x0 - x, y0 + y);
-		ST7920_SetPixel(color, x0 + x, y0 - y);
-		ST7920_SetPixel(color, x0 - x, y0 - y);
-		ST7920_SetPixel(color, x0 + y, y0 + x);
-		ST7920_SetPixel(color, x0 - y, y0 + x);
-		ST7920_SetPixel(color, x0 + y, y0 - x);
-		ST7920_SetPixel(color, x0 - y, y0 - x);
-
-		y++;
-		err += 1 + 2*y;
-
-		if (2*(err - x) + 1 > 0)
-		{
-			x--;
-			err += 1 - 2*x;
-		}
-	}
+	GFX_DrawCircle(&ST7920_Display, color, x0, y0, radius);
 }
 
 /*******************************************************************
@@ -422,36 +687,7 @@ void ST7920_DrawCircle(uint8_t color, uint8_t x0, uint8_t y0, uint8_t radius)
 ********************************************************************/ 
 void ST7920_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r)
 {
-	int16_t f = 1 - r;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * r;
-	int16_t x = 0;
-	int16_t y = r;
-
-	ST7920_SetPixel(color, x0, y0 + r);
-	ST7920_SetPixel(color, x0, y0 - r);
-	ST7920_SetPixel(color, x0 + r, y0);
-	ST7920_SetPixel(color, x0 - r, y0);
-	ST7920_DrawLine(color, x0 - r, y0, x0 + r, y0);
-
-	while (x < y) 
-	{
-		if (f >= 0) 
-		{
-			y--;
-			ddF_y += 2;
-			f += ddF_y;
-		}
-		x++;
-		ddF_x += 2;
-		f += ddF_x;
-		
-		ST7920_DrawLine(color, x0 - x, y0 + y, x0 + x, y0 + y);
-		ST7920_DrawLine(color, + x, y0 - y, x0 - x, y0 - y);
-		
-		ST7920_DrawLine(color, + y, y0 + x, x0 - y, y0 + x);
-		ST7920_DrawLine(color, + y, y0 - x, x0 - y, y0 - x);
-	}
+	GFX_DrawFilledCircle(&ST7920_Display, color, x0, y0, r);
 }
 
 /*******************************************************************
@@ -463,9 +699,9 @@ void ST7920_DrawFilledCircle(uint8_t color, int16_t x0, int16_t y0, int16_t r)
 ********************************************************************/ 
 void ST7920_ClearBuffer(void)
 {
-	uint16_t bufferSize = (ST7920_WIDTH*ST7920_HEIGHT)/ST7920_DATA_SIZE;
-	for (int i=0; i<bufferSize; i++)
-		ST7920_Buffer[i] = 0;
+	memset(ST7920_Buffer, 0, (ST7920_WIDTH*ST7920_HEIGHT)/ST7920_DATA_SIZE);
+
+	ST7920_MarkAllDirty();
 }
 
 /*******************************************************************
@@ -479,8 +715,11 @@ void ST7920_Init(void)
 {
 	// Wait 100ms
 	TIM_Wait(100);
-	// Initialize SPI link
-	ST7920_SpiInit();
+	// Initialize SPI bus and add the screen to it
+	SPI_Init();
+	SPI_Register(&ST7920_Spi);
+	// Initialization of the reset pin
+	GPIO_PinMode(ST7920_RST_PORT, ST7920_RST_PIN, OUTPUT);
 	// Reset LOW
 	ST7920_RST_LOW;
 	// Wait 50ms
@@ -517,4 +756,10 @@ void ST7920_Init(void)
 	ST7920_SendCmd(ST7920_CMD_HOME);
 	// Wait 1ms
 	TIM_Wait(1);
+	// Screen cleared: DDRAM holds spaces, GDRAM content unknown, the first flush sends everything
+	ST7920_InstructionSet = ST7920_CMD_BASIC;
+	ST7920_TextClear();
+	memset(ST7920_TextShadow, ' ', sizeof(ST7920_TextShadow));
+	ST7920_MarkAllDirty();
+	ST7920_ForceFlush = 1;
 }
@@ -1,19 +1,184 @@
 #include "tim.h"
 
+// Milliseconds since TIM_Init, SysTick clocks per microsecond
+static volatile uint32_t TIM_Ticks = 0;
+static uint32_t TIM_ClocksPerMicro = 16;
+static uint8_t TIM_Ready = 0;
+
+/*******************************************************************
+ * @name       :TIM_Init
+ * @date       :2026-10-17
+ * @function   :Start the 1 kHz SysTick interrupt of the time base,
+ *              done once. Follows SystemCoreClock
+ * @parameters :None
+ * @retvalue   :None
+********************************************************************/
+void TIM_Init(void)
+{
+	if (TIM_Ready) return;
+
+	TIM_ClocksPerMicro = SystemCoreClock / 1000000;
+
+	SysTick->LOAD = SystemCoreClock / 1000 - 1;
+	SysTick->VAL = 0;
+	NVIC_SetPriority(SysTick_IRQn, TIM_SYSTICK_PRIORITY);
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+	TIM_Ready = 1;
+}
+
+/*******************************************************************
+ * @name       :SysTick_Handler
+ * @date       :2026-10-17
+ * @function   :Count the milliseconds
+ * @parameters :None
+ * @retvalue   :None
+********************************************************************/
+void SysTick_Handler(void)
+{
+	TIM_Ticks++;
+}
+
+/*******************************************************************
+ * @name       :TIM_Millis
+ * @date       :2026-10-17
+ * @function   :Time since TIM_Init, wraps after 49 days
+ * @parameters :None
+ * @retvalue   :Milliseconds
+********************************************************************/
+uint32_t TIM_Millis(void)
+{
+	return TIM_Ticks;
+}
+
+/*******************************************************************
+ * @name       :TIM_Micros
+ * @date       :2026-10-17
+ * @function   :Time since TIM_Init from the milliseconds and the
+ *              SysTick counter, wraps after 71 minutes. Also right
+ *              with interrupts masked for less than 1 ms
+ * @parameters :None
+ * @retvalue   :Microseconds
+********************************************************************/
+uint32_t TIM_Micros(void)
+{
+	uint32_t ms;
+	uint32_t count;
+	uint32_t pending;
+
+	do
+	{
+		ms = TIM_Ticks;
+		count = SysTick->VAL;
+		pending = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+	} while (ms != TIM_Ticks);
+
+	// The counter went through 0 but the interrupt is not served yet
+	uint32_t load = SysTick->LOAD;
+	if (pending && count > load / 2) ms++;
+
+	return ms * 1000 + (load - count) / TIM_ClocksPerMicro;
+}
+
+/*******************************************************************
+ * @name       :TIM_Elapsed
+ * @date       :2026-10-17
+ * @function   :Milliseconds since a time from TIM_Millis
+ * @parameters :since
+ * @retvalue   :Milliseconds
+********************************************************************/
+uint32_t TIM_Elapsed(uint32_t since)
+{
+	return TIM_Millis() - since;
+}
+
+/*******************************************************************
+ * @name       :TIM_ElapsedMicros
+ * @date       :2026-10-17
+ * @function   :Microseconds since a time from TIM_Micros
+ * @parameters :since
+ * @retvalue   :Microseconds
+********************************************************************/
+uint32_t TIM_ElapsedMicros(uint32_t since)
+{
+	return TIM_Micros() - since;
+}
+
+/*******************************************************************
+ * @name       :TIM_Deadline
+ * @date       :2026-10-17
+ * @function   :Time a number of milliseconds from now, for
+ *              TIM_Expired
+ * @parameters :ms
+ * @retvalue   :Deadline
+********************************************************************/
+uint32_t TIM_Deadline(uint32_t ms)
+{
+	return TIM_Millis() + ms;
+}
+
+/*******************************************************************
+ * @name       :TIM_Expired
+ * @date       :2026-10-17
+ * @function   :Check if a deadline is reached, right across the
+ *              wrap of the milliseconds
+ * @parameters :deadline
+ * @retvalue   :1 if reached, 0 otherwise
+********************************************************************/
+uint8_t TIM_Expired(uint32_t deadline)
+{
+	return (int32_t)(TIM_Millis() - deadline) >= 0;
+}
+
+/*******************************************************************
+ * @name       :TIM_Every
+ * @date       :2026-10-17
+ * @function   :Non-blocking periodic delay. The period starts again
+ *              from its last end, so it does not drift, or from now
+ *              if a whole period was missed
+ * @parameters :next (time of the next run, 0 to run at once), period (ms)
+ * @retvalue   :1 when the period is over, 0 otherwise
+********************************************************************/
+uint8_t TIM_Every(uint32_t *next, uint32_t period)
+{
+	uint32_t now = TIM_Millis();
+	if ((int32_t)(now - *next) < 0) return 0;
+
+	*next += period;
+	if ((int32_t)(now - *next) >= 0) *next = now + period;
+
+	return 1;
+}
+
+/*******************************************************************
+ * @name       :TIM_Advance
+ * @date       :2026-10-17
+ * @function   :Add time counted elsewhere while SysTick was stopped
+ *              (Stop mode)
+ * @parameters :ms
+ * @retvalue   :None
+********************************************************************/
+void TIM_Advance(uint32_t ms)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	TIM_Ticks += ms;
+	__set_PRIMASK(primask);
+}
+
 /*******************************************************************
  * @name       :TIM_WaitMicros
  * @date       :2024-01-03
  * @function   :Wait microseconds
  * @parameters :us
  * @retvalue   :None
-********************************************************************/ 
+********************************************************************/
 void TIM_WaitMicros(unsigned int us)
 {
-	SysTick->LOAD=16-1;
-	SysTick->VAL=0;
-	SysTick->CTRL=0x5;
-	for (unsigned i=0; i<us; i++) while(!(SysTick->CTRL &0x10000));
-	SysTick->CTRL=0;	
+	TIM_Init();
+
+	uint32_t start = TIM_Micros();
+	while (TIM_ElapsedMicros(start) < us);
 }
 
 /*******************************************************************
@@ -22,12 +187,18 @@ void TIM_WaitMicros(unsigned int us)
  * @function   :Wait milliseconds
  * @parameters :ms
  * @retvalue   :None
-********************************************************************/ 
+********************************************************************/
 void TIM_Wait(unsigned int ms)
 {
-	SysTick->LOAD=16000-1;
-	SysTick->VAL=0;
-	SysTick->CTRL=0x5;
-	for (unsigned int i=0; i<ms; i++) while(!(SysTick->CTRL &0x10000));
-	SysTick->CTRL=0;	
+	TIM_Init();
+
+	// Counted in microseconds, so a wait is never shorter than asked
+	uint32_t start = TIM_Micros();
+	while (ms > 1000)
+	{
+		while (TIM_ElapsedMicros(start) < 1000000);
+		start += 1000000;
+		ms -= 1000;
+	}
+	while (TIM_ElapsedMicros(start) < ms * 1000);
 }
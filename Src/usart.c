@@ -1,4 +1,8 @@
 #include "usart.h"
+#include "format.h"
+
+// Posted on each falling edge of RX, also in Stop mode where USART3 does not receive
+SCHED_Event USART_Serial_Event = { 0 };
 
 /*******************************************************************
  * @name       :USART_Serial_Begin
@@ -22,26 +26,107 @@ void USART_Serial_Begin(uint32_t baud_rate)
     USART3->CR1 = USART_CR1_TE; // Enable transmitter
     USART3->CR1 |= USART_CR1_RE; // Enable receiver
     USART3->CR1 |= USART_CR1_UE; // Enable USART3
+
+    // RX line activity on EXTI line 9, wakes the core up from Stop mode
+    RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+    SYSCFG->EXTICR[2] = (SYSCFG->EXTICR[2] & ~SYSCFG_EXTICR3_EXTI9) | SYSCFG_EXTICR3_EXTI9_PD;
+    EXTI->FTSR |= EXTI_FTSR_TR9; // Start bit
+    EXTI->IMR |= EXTI_IMR_MR9;
+    NVIC_SetPriority(EXTI9_5_IRQn, 4);
+    NVIC_EnableIRQ(EXTI9_5_IRQn);
+}
+
+/*******************************************************************
+ * @name       :USART_Serial_PutChar
+ * @date       :2026-10-17
+ * @function   :Sends one formatted character via USART3.
+ * @parameters :context - Unused, c - Character to send.
+ * @retvalue   :None
+********************************************************************/
+static void USART_Serial_PutChar(void *context, char c)
+{
+    (void)context;
+    while (!(USART3->ISR & USART_ISR_TXE)); // Wait until the TX register is empty
+    USART3->TDR = c; // Transmit character
 }
 
 /*******************************************************************
  * @name       :USART_Serial_Print
  * @date       :2024-01-03
- * @function   :Sends formatted text via USART3 for serial communication.
+ * @function   :Sends formatted text via USART3 for serial communication,
+ *              characters are sent as they are formatted.
  * @parameters :format - Format string as in printf, followed by variables to format.
  * @retvalue   :None
 ********************************************************************/
 void USART_Serial_Print(const char *format, ...) 
 {
-    char buffer[128]; // Buffer for storing the formatted string
     va_list args;
     va_start(args, format);
-    vsnprintf(buffer, sizeof(buffer), format, args); // Format the input string
+    FORMAT_Print(USART_Serial_PutChar, 0, format, args);
     va_end(args);
+}
+
+/*******************************************************************
+ * @name       :USART_Serial_Write
+ * @date       :2026-10-17
+ * @function   :Sends raw bytes via USART3.
+ * @parameters :data - Bytes to send, length - Number of bytes.
+ * @retvalue   :None
+********************************************************************/
+void USART_Serial_Write(const uint8_t *data, uint16_t length)
+{
+    for (uint16_t n = 0; n < length; n++) USART_Serial_PutChar(0, data[n]);
+}
+
+/*******************************************************************
+ * @name       :USART_Serial_Read
+ * @date       :2026-10-17
+ * @function   :Gets a received byte from USART3 without waiting.
+ * @parameters :None
+ * @retvalue   :Received byte, or -1 if there is none.
+********************************************************************/
+int USART_Serial_Read(void)
+{
+    if (USART3->ISR & USART_ISR_ORE) USART3->ICR = USART_ICR_ORECF; // An overrun stops the reception
+    if (!(USART3->ISR & USART_ISR_RXNE)) return -1;
+    return USART3->RDR & 0xFF;
+}
+
+/*******************************************************************
+ * @name       :USART_Serial_SendFrame
+ * @date       :2026-10-17
+ * @function   :Sends a framebuffer capture via USART3. The header lets
+ *              Tools/fbcapture.py find it among text, the checksum is
+ *              the sum of the data bytes modulo 256.
+ * @parameters :layout - USART_FRAME_PAGES or USART_FRAME_ROWS,
+ *              width, height - Size in pixels,
+ *              data - Framebuffer, length - Size in bytes.
+ * @retvalue   :None
+********************************************************************/
+void USART_Serial_SendFrame(uint8_t layout, uint16_t width, uint16_t height, const uint8_t *data, uint16_t length)
+{
+    uint8_t header[9] = { 'F', 'B', layout, width & 0xFF, width >> 8, height & 0xFF, height >> 8, length & 0xFF, length >> 8 };
+    uint8_t checksum = 0;
+
+    for (uint16_t n = 0; n < length; n++) checksum += data[n];
+
+    USART_Serial_Write(header, sizeof(header));
+    USART_Serial_Write(data, length);
+    USART_Serial_Write(&checksum, 1);
+}
 
-    for (int i = 0; buffer[i] != '\0'; i++)
+/*******************************************************************
+ * @name       :EXTI9_5_IRQHandler
+ * @date       :2026-10-17
+ * @function   :Activity on the RX line, posts USART_Serial_Event.
+ * @parameters :None
+ * @retvalue   :None
+********************************************************************/
+void EXTI9_5_IRQHandler(void)
+{
+    if (EXTI->PR & EXTI_PR_PR9)
     {
-        while (!(USART3->ISR & USART_ISR_TXE)); // Wait until the TX register is empty
-        USART3->TDR = buffer[i]; // Transmit character
+        EXTI->PR = EXTI_PR_PR9; // Clear interrupt flag
+        SCHED_Post(&USART_Serial_Event);
     }
 }
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""Get framebuffer captures from the firmware and compare them.
+
+The firmware sends the frame it just drew on USART3 when it receives
+'c' (see USART_Serial_SendFrame). A frame is "FB", the layout, the
+width, height and data length (16-bit, LSB first), the framebuffer and
+the sum of its bytes modulo 256. Text printed on the same line is
+skipped.
+
+Layouts:
+  0  pages of width bytes, one byte per 8-pixel column, LSB on top (SH1106)
+  1  rows of width/8 bytes, MSB on the left (ST7920)
+
+Commands:
+  capture  send 'c' to a serial port (again until the frame starts, the
+           first one wakes the firmware up) and save the frame as PBM (needs pyserial)
+  convert  save the frames found in a raw dump of the serial line as PBM
+  diff     compare two PBM images pixel by pixel, exit status 1 if they differ
+
+Examples:
+  fbcapture.py capture /dev/ttyACM0 -o clock.pbm
+  fbcapture.py convert dump.bin -o frame.pbm --crop 128
+  fbcapture.py diff golden/clock.pbm clock.pbm -o changed.pbm
+"""
+
+import argparse
+import sys
+import time
+
+MAGIC = b"FB"
+HEADER = 9
+
+
+class Image:
+    def __init__(self, width, height, pixels):
+        self.width = width
+        self.height = height
+        self.pixels = pixels      # one list of 0/1 per row
+
+    def crop(self, width):
+        return Image(min(width, self.width), self.height, [row[:width] for row in self.pixels])
+
+
+def decode(layout, width, height, data):
+    if layout == 0:
+        pixels = [[(data[(y // 8) * width + x] >> (y % 8)) & 1 for x in range(width)] for y in range(height)]
+    elif layout == 1:
+        stride = (width + 7) // 8
+        pixels = [[(data[y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(width)] for y in range(height)]
+    else:
+        raise ValueError("unknown layout %d" % layout)
+    return Image(width, height, pixels)
+
+
+def find_frames(stream):
+    """Frames with a valid length and checksum, in the order received."""
+    frames = []
+    start = 0
+    while True:
+        start = stream.find(MAGIC, start)
+        if start < 0 or start + HEADER > len(stream):
+            return frames
+        layout = stream[start + 2]
+        width = stream[start + 3] | stream[start + 4] << 8
+        height = stream[start + 5] | stream[start + 6] << 8
+        length = stream[start + 7] | stream[start + 8] << 8
+        end = start + HEADER + length
+        data = stream[start + HEADER:end]
+        if (end < len(stream) and layout in (0, 1) and length * 8 >= width * height
+                and sum(data) & 0xFF == stream[end]):
+            frames.append(decode(layout, width, height, data))
+            start = end + 1
+        else:
+            start += 1
+
+
+def read_serial(port, baud, timeout, retry):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("capture needs pyserial (pip install pyserial)")
+
+    # The firmware may be in Stop mode: the first 'c' only wakes it up and is
+    # lost, so it is sent again until a frame starts
+    deadline = time.monotonic() + timeout
+    with serial.Serial(port, baud, timeout=retry) as line:
+        line.reset_input_buffer()
+        stream = b""
+        while time.monotonic() < deadline:
+            if MAGIC not in stream:
+                line.write(b"c")
+            chunk = line.read(256)
+            stream += chunk
+            if find_frames(stream):
+                return stream
+        return stream
+
+
+def write_pbm(image, path):
+    stride = (image.width + 7) // 8
+    data = bytearray()
+    for row in image.pixels:
+        line = bytearray(stride)
+        for x, pixel in enumerate(row):
+            if pixel:
+                line[x // 8] |= 0x80 >> (x % 8)
+        data += line
+    with open(path, "wb") as out:
+        out.write(b"P4\n%d %d\n" % (image.width, image.height))
+        out.write(data)
+
+
+def read_pbm(path):
+    with open(path, "rb") as f:
+        content = f.read()
+
+    # Header: magic, width, height, separated by whitespace and comments
+    fields = []
+    pos = 0
+    while len(fields) < 3:
+        while content[pos:pos + 1].isspace():
+            pos += 1
+        if content[pos:pos + 1] == b"#":
+            pos = content.index(b"\n", pos)
+            continue
+        end = pos
+        while not content[end:end + 1].isspace():
+            end += 1
+        fields.append(content[pos:end])
+        pos = end
+    if fields[0] != b"P4":
+        sys.exit("%s: not a binary PBM" % path)
+    width, height = int(fields[1]), int(fields[2])
+    data = content[pos + 1:]
+
+    stride = (width + 7) // 8
+    pixels = [[(data[y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(width)] for y in range(height)]
+    return Image(width, height, pixels)
+
+
+def save(frames, output, crop):
+    if not frames:
+        sys.exit("no frame found")
+    for n, image in enumerate(frames):
+        if crop:
+            image = image.crop(crop)
+        path = output if len(frames) == 1 else output.replace(".pbm", "") + "_%d.pbm" % n
+        write_pbm(image, path)
+        print("%s: %dx%d" % (path, image.width, image.height))
+
+
+def diff(first, second, output):
+    if (first.width, first.height) != (second.width, second.height):
+        print("size differs: %dx%d and %dx%d" % (first.width, first.height, second.width, second.height))
+        return 1
+
+    changed = [[a ^ b for a, b in zip(row_a, row_b)] for row_a, row_b in zip(first.pixels, second.pixels)]
+    points = [(x, y) for y, row in enumerate(changed) for x, pixel in enumerate(row) if pixel]
+    if output:
+        write_pbm(Image(first.width, first.height, changed), output)
+    if not points:
+        print("identical")
+        return 0
+
+    xs = [x for x, _ in points]
+    ys = [y for _, y in points]
+    print("%d pixels differ in x %d..%d, y %d..%d" % (len(points), min(xs), max(xs), min(ys), max(ys)))
+    return 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    capture = commands.add_parser("capture", help="capture a frame from a serial port")
+    capture.add_argument("port")
+    capture.add_argument("-o", "--output", required=True, help="PBM file to write")
+    capture.add_argument("--baud", type=int, default=9600, help="baud rate (default 9600)")
+    capture.add_argument("--timeout", type=float, default=10, help="seconds before giving up")
+    capture.add_argument("--retry", type=float, default=0.5, help="seconds between two 'c' until a frame starts")
+    capture.add_argument("--crop", type=int, help="keep the first columns only (128 for the SH1106)")
+
+    convert = commands.add_parser("convert", help="extract frames from a raw serial dump")
+    convert.add_argument("input")
+    convert.add_argument("-o", "--output", required=True, help="PBM file to write, numbered if several frames")
+    convert.add_argument("--crop", type=int, help="keep the first columns only (128 for the SH1106)")
+
+    compare = commands.add_parser("diff", help="compare two PBM images")
+    compare.add_argument("first")
+    compare.add_argument("second")
+    compare.add_argument("-o", "--output", help="PBM file showing the pixels that differ")
+
+    args = parser.parse_args()
+
+    if args.command == "capture":
+        save(find_frames(read_serial(args.port, args.baud, args.timeout, args.retry))[:1], args.output, args.crop)
+    elif args.command == "convert":
+        with open(args.input, "rb") as f:
+            save(find_frames(f.read()), args.output, args.crop)
+    else:
+        sys.exit(diff(read_pbm(args.first), read_pbm(args.second), args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+"""Convert fonts to the packed format of Fonts/fonts.h.
+
+Each glyph is stored as its columns only, top to bottom, with
+bytesPerColums bytes per column (LSB = top pixel of each byte), and a
+FontGlyph table gives the offset and width of every code between
+asciiBegin and asciiEnd. Codes that are not in the font get a width
+of 0, so sparse character sets cost 3-4 bytes per missing code.
+
+Sources:
+  bdf     BDF bitmap font (no dependency)
+  ttf     TrueType/OpenType font rendered at a pixel size (needs Pillow)
+  legacy  C file in the previous fixed-size format (one datasize block
+          per glyph, first byte = width), used to migrate old fonts
+
+Examples:
+  fontconv.py bdf  helvR12.bdf --name Helvetica12 -o Fonts/fonts_helvetica12.c
+  fontconv.py ttf  arial.ttf --size 28 --chars "0123456789:" --name Clock28 -o Fonts/fonts_clock28.c
+  fontconv.py legacy old/fonts_arial12x12.c -o Fonts/fonts_arial12x12.c
+"""
+
+import argparse
+import re
+import sys
+
+
+class Glyph:
+    def __init__(self, width, columns):
+        self.width = width        # columns drawn, also the advance
+        self.columns = columns    # one int per column, bit n = row n
+
+
+class PackedFont:
+    def __init__(self, name, height, spacing, glyphs):
+        self.name = name
+        self.height = height
+        self.spacing = spacing
+        self.glyphs = glyphs      # code -> Glyph
+
+
+def select(glyphs, first, last, chars):
+    """Keep the requested codes only."""
+    if chars is not None:
+        wanted = set(ord(c) for c in chars)
+    else:
+        wanted = set(range(first, last + 1))
+    return {code: g for code, g in glyphs.items() if code in wanted}
+
+
+def read_bdf(path, first, last, chars):
+    glyphs = {}
+    ascent = descent = None
+    bbox = None
+    code = dwidth = None
+    bbx = None
+    rows = None
+
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            words = line.split()
+            if not words:
+                continue
+            key = words[0]
+            if rows is not None and key != "ENDCHAR":
+                rows.append((int(words[0], 16), len(words[0]) * 4))
+                continue
+            if key == "FONTBOUNDINGBOX":
+                bbox = [int(v) for v in words[1:5]]
+            elif key == "FONT_ASCENT":
+                ascent = int(words[1])
+            elif key == "FONT_DESCENT":
+                descent = int(words[1])
+            elif key == "ENCODING":
+                code = int(words[1])
+            elif key == "DWIDTH":
+                dwidth = int(words[1])
+            elif key == "BBX":
+                bbx = [int(v) for v in words[1:5]]
+            elif key == "BITMAP":
+                rows = []
+            elif key == "ENDCHAR":
+                if code is not None and code >= 0:
+                    glyphs[code] = bdf_glyph(rows, bbx, dwidth, ascent, bbox)
+                code = dwidth = bbx = rows = None
+
+    if ascent is None or descent is None:
+        ascent = bbox[1] + bbox[3]
+        descent = -bbox[3]
+    return ascent + descent, select(glyphs, first, last, chars)
+
+
+def bdf_glyph(rows, bbx, dwidth, ascent, bbox):
+    if bbx is None:
+        bbx = bbox
+    bw, bh, bx, by = bbx
+    if dwidth is None:
+        dwidth = bx + bw
+    width = max(dwidth, bx + bw, 0)
+    columns = [0] * width
+    top = ascent - (by + bh)
+
+    for r, (bits, nbits) in enumerate(rows or []):
+        y = top + r
+        if y < 0:
+            continue
+        for c in range(bw):
+            x = bx + c
+            if 0 <= x < width and bits & (1 << (nbits - 1 - c)):
+                columns[x] |= 1 << y
+    return Glyph(width, columns)
+
+
+def read_ttf(path, size, first, last, chars, threshold):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit("ttf input needs Pillow (pip install pillow)")
+
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+    codes = [ord(c) for c in chars] if chars is not None else range(first, last + 1)
+
+    glyphs = {}
+    for code in codes:
+        ch = chr(code)
+        left, _, right, _ = font.getbbox(ch)
+        advance = int(round(font.getlength(ch)))
+        shift = -min(left, 0)
+        width = max(advance, right) + shift
+        if width <= 0:
+            continue
+
+        image = Image.new("L", (width, height), 0)
+        ImageDraw.Draw(image).text((shift, 0), ch, font=font, fill=255)
+        pixels = image.load()
+        columns = [0] * width
+        for x in range(width):
+            for y in range(height):
+                if pixels[x, y] >= threshold:
+                    columns[x] |= 1 << y
+        glyphs[code] = Glyph(width, columns)
+    return height, glyphs
+
+
+def read_legacy(path):
+    text = open(path).read()
+    fields = dict(re.findall(r"\.(\w+)\s*=\s*(\w+)", text))
+    data = re.search(r"_Data\[\]\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    values = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", data)]
+
+    datasize = int(fields["datasize"])
+    bytes_per_column = int(fields["bytesPerColums"])
+    first = int(fields["asciiOffset"])
+
+    glyphs = {}
+    for index in range(len(values) // datasize):
+        block = values[index * datasize:(index + 1) * datasize]
+        width = block[0]
+        columns = []
+        for c in range(width):
+            column = 0
+            for b in range(bytes_per_column):
+                column |= block[1 + c * bytes_per_column + b] << (8 * b)
+            columns.append(column)
+        glyphs[first + index] = Glyph(width, columns)
+
+    name = fields["data"].rsplit("_Data", 1)[0]
+    height = int(fields["height"])
+    spacing = int(fields["length"]) // 10
+    return PackedFont(name, height, spacing, glyphs)
+
+
+def char_comment(code):
+    # A backslash would continue the // comment onto the next line
+    if code == ord("\\"):
+        return "char BackSlash"
+    if 32 < code < 127:
+        return "char " + chr(code)
+    return "code 0x%02X" % code
+
+
+def write_c(font, out):
+    codes = sorted(font.glyphs)
+    if not codes:
+        sys.exit("no glyph selected")
+    first, last = codes[0], codes[-1]
+    bytes_per_column = (font.height + 7) // 8
+    guard = "FONTS_%s_H_" % font.name.upper()
+
+    data_lines = []
+    table_lines = []
+    offset = 0
+    for code in range(first, last + 1):
+        glyph = font.glyphs.get(code)
+        if glyph is None or glyph.width == 0:
+            table_lines.append("\t{ 0, 0 },  // %s (missing)" % char_comment(code))
+            continue
+        if offset + glyph.width * bytes_per_column > 0xFFFF:
+            sys.exit("font data larger than 64 KiB")
+
+        values = []
+        for column in glyph.columns:
+            for b in range(bytes_per_column):
+                values.append("0x%02X" % ((column >> (8 * b)) & 0xFF))
+        data_lines.append("\t" + ", ".join(values) + ",  // " + char_comment(code))
+        table_lines.append("\t{ %d, %d },  // %s" % (offset, glyph.width, char_comment(code)))
+        offset += len(values)
+
+    lines = [
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        "#include <stdint.h>",
+        "",
+        '#include "fonts.h"',
+        "",
+        "// Generated by Tools/fontconv.py",
+        "",
+        "static const uint8_t %s_Data[] =" % font.name,
+        "{",
+    ]
+    lines += data_lines
+    lines += [
+        "};",
+        "",
+        "static const FontGlyph %s_Glyphs[] =" % font.name,
+        "{",
+    ]
+    lines += table_lines
+    lines += [
+        "};",
+        "",
+        "const Font %s = {" % font.name,
+        "\t.data = %s_Data," % font.name,
+        "\t.glyphs = %s_Glyphs," % font.name,
+        "\t.asciiBegin = %d," % first,
+        "\t.asciiEnd = %d," % last,
+        "\t.height = %d," % font.height,
+        "\t.bytesPerColums = %d," % bytes_per_column,
+        "\t.spacing = %d" % font.spacing,
+        "};",
+        "",
+        "#endif",
+        "",
+    ]
+    out.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", choices=["bdf", "ttf", "legacy"])
+    parser.add_argument("input")
+    parser.add_argument("-o", "--output", help="C file to write (default: stdout)")
+    parser.add_argument("--name", help="font name, e.g. Arial12x12 (required for bdf/ttf)")
+    parser.add_argument("--size", type=int, help="pixel size for ttf")
+    parser.add_argument("--first", type=int, default=32, help="first code (default 32)")
+    parser.add_argument("--last", type=int, default=126, help="last code (default 126)")
+    parser.add_argument("--chars", help="exact characters to keep instead of first..last")
+    parser.add_argument("--spacing", type=int, help="columns added between letters")
+    parser.add_argument("--threshold", type=int, default=128, help="ttf gray level drawn as set (default 128)")
+    args = parser.parse_args()
+
+    if args.source == "legacy":
+        font = read_legacy(args.input)
+        if args.name:
+            font.name = args.name
+    else:
+        if not args.name:
+            parser.error("--name is required")
+        if args.source == "bdf":
+            height, glyphs = read_bdf(args.input, args.first, args.last, args.chars)
+        else:
+            if not args.size:
+                parser.error("--size is required for ttf")
+            height, glyphs = read_ttf(args.input, args.size, args.first, args.last, args.chars, args.threshold)
+        font = PackedFont(args.name, height, 0, glyphs)
+
+    if args.spacing is not None:
+        font.spacing = args.spacing
+    if args.output:
+        with open(args.output, "w", newline="\n") as out:
+            write_c(font, out)
+    else:
+        write_c(font, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
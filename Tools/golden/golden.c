@@ -0,0 +1,110 @@
+// Host build of the rasterizer: draws the screens of the clock into a RAM
+// framebuffer with the SH1106 page layout and writes each one as a frame
+// in the USART_Serial_SendFrame format, converted to PBM by fbcapture.py
+
+#include <stdio.h>
+#include <string.h>
+
+#include "screen.h"
+
+// Same layout as the SH1106 buffer: pages of 132 columns, LSB on top
+#define GOLDEN_WIDTH  132
+#define GOLDEN_HEIGHT 64
+
+static uint8_t GOLDEN_Buffer[GOLDEN_HEIGHT / 8][GOLDEN_WIDTH];
+
+static void GOLDEN_PutPixel(uint8_t color, int16_t x, int16_t y)
+{
+	if (color) GOLDEN_Buffer[y / 8][x] |= 1 << (y % 8);
+	else GOLDEN_Buffer[y / 8][x] &= ~(1 << (y % 8));
+}
+
+static void GOLDEN_FillRect(uint8_t color, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	for (int16_t row = y; row < y + h; row++)
+		for (int16_t column = x; column < x + w; column++) GOLDEN_PutPixel(color, column, row);
+}
+
+static const GFX_Display GOLDEN_Display = { GOLDEN_WIDTH, GOLDEN_HEIGHT, GOLDEN_PutPixel, GOLDEN_FillRect, 0 };
+
+// Lit pixels outside the area left by the orbit margin, they wrap or leave the screen
+static int GOLDEN_CheckMargin(const char *name)
+{
+	int outside = 0;
+
+	for (int y = 0; y < GOLDEN_HEIGHT; y++)
+	{
+		for (int x = 0; x < GOLDEN_WIDTH; x++)
+		{
+			uint8_t lit = (GOLDEN_Buffer[y / 8][x] >> (y % 8)) & 1;
+			if (lit && (y < SCREEN_MARGIN || y >= GOLDEN_HEIGHT - SCREEN_MARGIN || x < SCREEN_MARGIN || x >= SCREEN_WIDTH - SCREEN_MARGIN)) outside++;
+		}
+	}
+
+	if (outside) fprintf(stderr, "%s: %d pixels in the orbit margin\n", name, outside);
+	return outside != 0;
+}
+
+// Frame file: "FB", layout 0, width, height, length (16-bit, LSB first), data, checksum
+static int GOLDEN_Write(const char *directory, const char *name)
+{
+	char path[256];
+	snprintf(path, sizeof(path), "%s/%s.bin", directory, name);
+
+	FILE *out = fopen(path, "wb");
+	if (!out)
+	{
+		perror(path);
+		return 1;
+	}
+
+	uint16_t length = sizeof(GOLDEN_Buffer);
+	uint8_t header[9] = { 'F', 'B', 0, GOLDEN_WIDTH & 0xFF, GOLDEN_WIDTH >> 8, GOLDEN_HEIGHT & 0xFF, GOLDEN_HEIGHT >> 8, length & 0xFF, length >> 8 };
+	uint8_t checksum = 0;
+	for (uint16_t n = 0; n < length; n++) checksum += ((const uint8_t *)GOLDEN_Buffer)[n];
+
+	fwrite(header, 1, sizeof(header), out);
+	fwrite(GOLDEN_Buffer, 1, length, out);
+	fwrite(&checksum, 1, 1, out);
+	fclose(out);
+
+	return GOLDEN_CheckMargin(name);
+}
+
+int main(int argc, char **argv)
+{
+	const char *directory = argc > 1 ? argv[1] : ".";
+	int failed = 0;
+
+	// Clock face, widest values of each field
+	const SCREEN_Clock clocks[] = {
+		{ 0, 55, 21, 6, 10, 3, 1, 0, 21.5f },
+		{ 59, 58, 23, 3, 30, 9, 99, 0, -12.5f },
+	};
+	for (unsigned n = 0; n < sizeof(clocks) / sizeof(clocks[0]); n++)
+	{
+		char name[16];
+		snprintf(name, sizeof(name), "clock_%u", n);
+
+		memset(GOLDEN_Buffer, 0, sizeof(GOLDEN_Buffer));
+		SCREEN_ClockBackground(&GOLDEN_Display);
+		SCREEN_ClockValues(&GOLDEN_Display, &clocks[n]);
+		failed |= GOLDEN_Write(directory, name);
+	}
+
+	// Settings pages, in the order of MAIN_Settings (move 0..6)
+	static const struct { const char *title; int value; } settings[] = {
+		{ "sec", 59 }, { "min", 58 }, { "hour", 23 }, { "dayW", 7 }, { "day", 31 }, { "month", 12 }, { "year", 99 },
+	};
+	for (unsigned n = 0; n < sizeof(settings) / sizeof(settings[0]); n++)
+	{
+		char name[16];
+		snprintf(name, sizeof(name), "setting_%u", n);
+
+		memset(GOLDEN_Buffer, 0, sizeof(GOLDEN_Buffer));
+		SCREEN_Setting(&GOLDEN_Display, settings[n].title, settings[n].value);
+		failed |= GOLDEN_Write(directory, name);
+	}
+
+	return failed;
+}